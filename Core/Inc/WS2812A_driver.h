@@ -13,8 +13,27 @@ extern "C" {
 #include <stdbool.h>
 
 #define WS2812A_TASK    (1 << CFG_TASK_LIGHT_HANDLER)
-#define WS2812A_TASK_INTERVAL     40  /* task interval in ms */
+#define WS2812A_FRAME_INTERVAL_MIN  10   /* shortest frame interval (100 Hz); longer if the strip transmission takes longer [ms] */
+#define WS2812A_FRAME_INTERVAL_MAX  100  /* longest frame interval of a running transition or effect [ms] */
 #define WS2812A_START_ON_LEVEL 30  /* light on level on startup */
+#define WS2812A_MAX_SAT  254   /* maximal saturation of the ZCL color cluster */
+#define WS2812A_HUE   0x01    /* hue component of the hue_sat functions */
+#define WS2812A_SAT   0x02    /* saturation component of the hue_sat functions */
+#define WS2812A_MAX_STRIPS  2   /* max number of strips driven simultaneously by separate SPI/DMA channels */
+#define WS2812A_QUEUE_SIZE  16  /* number of commands waiting for the frame task; power of 2 */
+#define WS2812A_LOOP_DIR_KEEP  0xFF    /* loop direction of WS2812A_CMD_LOOP_START keeping the current direction */
+#define WS2812A_MAX_LANES  8    /* max number of strips driven in lockstep by the pins 0..7 of a GPIO port */
+#define WS2812A_STREAM_DEVS  16  /* number of devices encoded into each half of the pulse ring of a streamed strip */
+/* define WS2812A_INDEXED_COLORS to keep an 8-bit index of a palette of 256 colors per device instead of its RGB color;
+   a color beyond 256 different device colors takes the nearest palette color */
+/* define WS2812A_PARALLEL_OUTPUT (with HAL_TIM_MODULE_ENABLED) to drive the lanes of a GPIO port by a timer instead of an SPI;
+   the .ioc configures no timer with update DMA yet, so only the host simulation defines it */
+#if defined(WS2812A_PARALLEL_OUTPUT) && !defined(HAL_TIM_MODULE_ENABLED)
+#error "WS2812A_PARALLEL_OUTPUT requires HAL_TIM_MODULE_ENABLED"
+#endif
+#ifndef WS2812A_POOL_SIZE
+#define WS2812A_POOL_SIZE   (24 * 1024)   /* size of memory pool for RGB, group and pulse buffers of all strips [B] */
+#endif
 
 typedef enum
 {
@@ -23,23 +42,91 @@ typedef enum
 } WS2812A_ColorTypeDef;
 typedef enum
 {
-    COLOR_LOOP_CYCLIC_GROUPS_FAST,
-    COLOR_LOOP_CYCLIC_GROUPS_SLOW,
-    COLOR_LOOP_CYCLIC_ALL_FAST,
-    COLOR_LOOP_CYCLIC_ALL_SLOW,
-    COLOR_LOOP_RANDOM_GROUPS_FAST,
-    COLOR_LOOP_RANDOM_GROUPS_SLOW,
-    COLOR_LOOP_RANDOM_ALL_FAST,
-    COLOR_LOOP_RANDOM_ALL_SLOW,    
-    COLOR_LOOP_COMET_FREQUENT,
-    COLOR_LOOP_COMET_RARE,
-    COLOR_LOOP_NUMB_MODES   /* this entry must be the last one */
-} WS2812A_ColorLoopTypeDef;
+    WS2812A_PALETTE_RAINBOW,    /* full hue circle */
+    WS2812A_PALETTE_WARM,       /* red to yellow */
+    WS2812A_PALETTE_COOL,       /* green to blue */
+    WS2812A_NUMB_PALETTES   /* this entry must be the last one */
+} WS2812A_PaletteTypeDef;
+typedef enum
+{
+    WS2812A_ORDER_RGB,
+    WS2812A_ORDER_RBG,
+    WS2812A_ORDER_GRB,
+    WS2812A_ORDER_GBR,
+    WS2812A_ORDER_BRG,
+    WS2812A_ORDER_BGR,
+    WS2812A_NUMB_ORDERS     /* this entry must be the last one */
+} WS2812A_ColorOrderTypeDef;
+typedef enum
+{
+    WS2812A_ENCODING_5BIT,  /* 5 SPI bits per device bit; 15 pulse bytes per device */
+    WS2812A_ENCODING_4BIT,  /* 4 SPI bits per device bit; 12 pulse bytes per device */
+    WS2812A_ENCODING_3BIT,  /* 3 SPI bits per device bit; 9 pulse bytes per device */
+    WS2812A_NUMB_ENCODINGS  /* this entry must be the last one */
+} WS2812A_EncodingTypeDef;
+typedef enum
+{
+    WS2812A_HUE_SHORTEST,   /* values of the ZCL direction field */
+    WS2812A_HUE_LONGEST,
+    WS2812A_HUE_UP,
+    WS2812A_HUE_DOWN
+} WS2812A_HueDirTypeDef;
+#ifdef WS2812A_PARALLEL_OUTPUT
+/*
+ * Parallel output: the update DMA request of a timer writes the low byte of the GPIO port ODR
+ * 3 times per device bit (all lanes high, the data bits, all lanes low), so lane n on pin n gets
+ * bit 0 as 1/3 and bit 1 as 2/3 of the bit period. The DMA channel linked to phTIM->hdma[TIM_DMA_ID_UPDATE]
+ * must be memory to peripheral, byte wide, normal mode, with its interrupt enabled; the pins 0..7
+ * of the port are outputs owned by the driver. The timer is configured by the driver.
+ */
+typedef struct
+{
+    TIM_HandleTypeDef* phTIM;   /* timer triggering the DMA writes to the port */
+    GPIO_TypeDef* pPort;        /* GPIO port of the lanes */
+    uint8_t numb_lanes;         /* number of strips on the pins 0..numb_lanes-1 (1..WS2812A_MAX_LANES) */
+} WS2812A_ParallelConfig_t;
+#endif
+typedef struct
+{
+    SPI_HandleTypeDef* phSPI;   /* SPI with TX DMA channel driving the strip */
+    uint16_t numb_dev;          /* number of devices in the strip; in every lane of a parallel output */
+    WS2812A_ColorOrderTypeDef color_order;  /* order of colors expected by the strip devices */
+    bool streaming;             /* the pulses are encoded during the transmission into a ring of 2 x WS2812A_STREAM_DEVS devices;
+                                   the TX DMA channel must be circular (normal otherwise) */
+    WS2812A_EncodingTypeDef encoding;   /* SPI pulses of the device bits; the SPI prescaler is selected for them */
+#ifdef WS2812A_PARALLEL_OUTPUT
+    const WS2812A_ParallelConfig_t* pParallel;  /* lanes of a GPIO port used instead of phSPI; their devices follow
+                                                   one another in the RGB buffer, lane 0 first; NULL for an SPI strip */
+#endif
+} WS2812A_StripConfig_t;
+typedef struct
+{
+    uint32_t speed;         /* duration of the effect cycle: hue circle period, fade time or comet travel time [ms] */
+    uint32_t density;       /* mean interval between new comets [ms] */
+    WS2812A_PaletteTypeDef palette;     /* colors used by the effect */
+    bool use_groups;        /* the effect colors the device groups separately */
+} WS2812A_EffectParams_t;
+/*
+ * Animation asset in flash played by the effects following the effect registry, one effect per asset.
+ * Every frame is a delta record of the changes from the previous frame; frame 0 sets all devices.
+ * A record holds the number of runs, then every run as the number of devices skipped after the previous run,
+ * (the number of run devices << 1 | fill) and the RGB colors of the run devices, or one color of all of them if fill is set.
+ * The numbers are unsigned LEB128: 7 bits per byte, the lowest first, bit 7 set if more bytes follow.
+ */
+typedef struct
+{
+    const uint8_t* pData;       /* delta records of all frames */
+    uint32_t data_size;         /* [B] */
+    uint16_t numb_dev;          /* number of devices of a frame; the devices beyond keep their colors */
+    uint16_t numb_frames;
+    uint16_t frame_interval;    /* [ms] */
+} WS2812A_Asset_t;
 typedef struct
 {
     uint8_t level_target;   /* the level that the current level must reach; may be either level_on or 0 */
     uint8_t level_on;       /* the target level when the device is swithed on */
     uint32_t transition_time;  /* remaining level transition time [ms] */
+    uint32_t color_transition_time;    /* transition time of the next XY color change [ms] */
     bool set_color_XY;      /* set color from XY space */
     bool set_color_HS;      /* set color from HS space */
     bool set_color_temp;    /* set color temperature */
@@ -49,15 +136,133 @@ typedef struct
     RGB_t color_rgb;        /* current color in RGB space */
     uint16_t color_temp;    /* current color temperature in mireds */
     WS2812A_ColorTypeDef color_mode;    /* color mode static or loop effect */
-    WS2812A_ColorLoopTypeDef color_loop_mode;   /* color loop mode */
+    uint8_t effect;         /* index of the color loop effect in the effect registry */
+    WS2812A_EffectParams_t effect_params;   /* parameters of the running effect; reset to the effect defaults when it starts */
+    bool set_effect_params; /* apply changed effect_params to the running effect */
     uint8_t loop_direction; /* loop direction left or right */
 } Light_Params_t;
+typedef enum
+{
+    WS2812A_CMD_ON,             /* switch on at level_on */
+    WS2812A_CMD_OFF,
+    WS2812A_CMD_LEVEL_MOVE_TO,
+    WS2812A_CMD_LEVEL_MOVE,
+    WS2812A_CMD_LEVEL_STEP,
+    WS2812A_CMD_COLOR_XY,
+    WS2812A_CMD_HUE_SAT_MOVE_TO,
+    WS2812A_CMD_HUE_SAT_MOVE,
+    WS2812A_CMD_HUE_SAT_STEP,
+    WS2812A_CMD_TEMP_MOVE_TO,
+    WS2812A_CMD_TEMP_MOVE,
+    WS2812A_CMD_TEMP_STEP,
+    WS2812A_CMD_COLOR_STOP,     /* stop the hue, saturation, color temperature and XY color changes */
+    WS2812A_CMD_LOOP_START,
+    WS2812A_CMD_LOOP_STOP       /* restore the static color */
+} WS2812A_CommandTypeDef;
+typedef struct
+{
+    WS2812A_CommandTypeDef type;
+    union
+    {
+        struct
+        {
+            uint8_t level;
+            bool with_onoff;        /* the level is also the level target; otherwise only level_on is set */
+            uint32_t transition_time;   /* [ms] */
+        } level_move_to;
+        struct
+        {
+            uint8_t mode;           /* 0 = up, 1 = down */
+            uint8_t rate;           /* [levels/s]; 0 stops the move */
+        } level_move;
+        struct
+        {
+            uint8_t mode;           /* 0 = up, 1 = down */
+            uint8_t size;           /* [levels] */
+            uint32_t transition_time;   /* [ms] */
+        } level_step;
+        struct
+        {
+            XY_t color_xy;
+            uint32_t transition_time;   /* [ms] */
+        } color_xy;
+        struct
+        {
+            uint8_t components;     /* WS2812A_HUE, WS2812A_SAT or both */
+            uint16_t enh_hue;
+            uint8_t sat;
+            WS2812A_HueDirTypeDef direction;
+            uint32_t transition_time;   /* [ms] */
+        } hue_sat_move_to;
+        struct
+        {
+            uint8_t components;
+            int32_t rate;           /* [units/s]; 0 stops the move */
+        } hue_sat_move;
+        struct
+        {
+            uint8_t components;
+            int32_t step;
+            uint32_t transition_time;   /* [ms] */
+        } hue_sat_step;
+        struct
+        {
+            uint16_t color_temp;    /* [mireds] */
+            uint32_t transition_time;   /* [ms] */
+        } temp_move_to;
+        struct
+        {
+            int32_t rate;           /* [mireds/s]; 0 stops the move */
+            uint16_t temp_min;      /* limits of the move [mireds]; 0 = the table limit */
+            uint16_t temp_max;
+        } temp_move;
+        struct
+        {
+            int32_t step;           /* [mireds] */
+            uint32_t transition_time;   /* [ms] */
+            uint16_t temp_min;
+            uint16_t temp_max;
+        } temp_step;
+        struct
+        {
+            int8_t effect_step;     /* selects the next (1) or previous (-1) effect; 0 = the effect index */
+            uint8_t effect;         /* index of the effect in the effect registry */
+            uint8_t direction;      /* loop direction or WS2812A_LOOP_DIR_KEEP */
+        } loop_start;
+    };
+} WS2812A_Command_t;
+typedef struct
+{
+    volatile uint32_t frames_sent;      /* frames handed over to SPI DMA */
+    volatile uint32_t frames_deferred;  /* frames waiting for the end of the previous transmission */
+    volatile uint32_t frames_dropped;   /* frames superseded before transmission or rejected by SPI */
+    volatile uint32_t requested_frames; /* frames requested by posted commands and started */
+    volatile uint32_t latency_last;     /* time from the command to the DMA start of its frame [us] */
+    volatile uint32_t latency_max;      /* longest command latency [us] */
+    volatile uint32_t latency_total;    /* sum of the command latencies of all requested frames [us] */
+    volatile uint32_t commands_collapsed;   /* commands superseded by the next command of the same frame */
+    volatile uint32_t commands_dropped;     /* commands rejected by the full queue */
+    volatile uint32_t colors_merged;        /* device colors replaced by the nearest color of the full palette (WS2812A_INDEXED_COLORS) */
+} WS2812A_Stats_t;
 
 
-void WS2812A_Init(SPI_HandleTypeDef* phSPI);
-void brightness_move(uint8_t mode, uint8_t rate);
+bool WS2812A_Init(const WS2812A_StripConfig_t* pStripConfig, uint8_t numb_strips);
+bool WS2812A_SetGroups(const uint16_t* pGroupSize, uint16_t numb_groups);
+uint16_t WS2812A_GetNumbDev(void);
+uint8_t WS2812A_GetNumbEffects(void);
+void WS2812A_handler(void);
+void WS2812A_StartClock(void);
+bool WS2812A_PostCommand(const WS2812A_Command_t* pCommand);
+void bits_to_pulses(uint8_t color_value, uint8_t** ppBuffer);
+const WS2812A_Stats_t* WS2812A_GetStats(void);
+void WS2812A_RemainingTimeCallback(uint16_t remaining_time);
+void WS2812A_HueSatCallback(uint16_t enh_hue, uint8_t sat);
+void WS2812A_ColorTempCallback(uint16_t color_temp);
 
-extern Light_Params_t light_params;
+extern Light_Params_t light_params;   /* state of the frame task; the application changes it with WS2812A_PostCommand() */
+/* generated by Host/Src/gen_animation_assets.c */
+extern const WS2812A_Asset_t WS2812A_assets[];
+extern const uint8_t WS2812A_numb_assets;
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -0,0 +1,47 @@
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef ANIMATOR_H
+#define ANIMATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ANIM_ONE  0x10000   /* 1.0 in Q16.16 format */
+
+/* animated properties of the light */
+typedef enum
+{
+    ANIM_LEVEL,     /* light level <0,255> */
+    ANIM_HUE,       /* enhanced hue <0,0xFFFF>; wraps around */
+    ANIM_SAT,       /* saturation <0,254> */
+    ANIM_X,         /* CIE x <0,0xFFFF> */
+    ANIM_Y,         /* CIE y <0,0xFFFF> */
+    ANIM_MIREDS,    /* color temperature [mireds] */
+    ANIM_RED,       /* RGB fade components <0,255> */
+    ANIM_GREEN,
+    ANIM_BLUE,
+    ANIM_EFFECT,    /* phase [1/2^32 turn] or progress of the color loop effect; wraps around */
+    ANIM_NUMB_CHANNELS  /* this entry must be the last one */
+} ANIM_ChannelTypeDef;
+
+#define ANIM_MASK(channel)  (1UL << (channel))
+
+void ANIM_Set(ANIM_ChannelTypeDef channel, uint32_t value);
+void ANIM_Start(ANIM_ChannelTypeDef channel, int64_t change, uint32_t duration, uint32_t now);
+void ANIM_Move(ANIM_ChannelTypeDef channel, int64_t rate, uint32_t now);
+void ANIM_Stop(ANIM_ChannelTypeDef channel);
+uint32_t ANIM_Update(uint32_t now);
+uint32_t ANIM_Value(ANIM_ChannelTypeDef channel);
+uint32_t ANIM_Target(ANIM_ChannelTypeDef channel);
+bool ANIM_Active(ANIM_ChannelTypeDef channel);
+uint32_t ANIM_Remaining(ANIM_ChannelTypeDef channel, uint32_t now);
+uint32_t ANIM_StepTime(ANIM_ChannelTypeDef channel, uint32_t step);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*ANIMATOR_H */
@@ -0,0 +1,35 @@
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#ifdef WS2812A_HOST_BUILD
+#define BENCH_UNIT  "ns"        /* host time unit */
+#else
+#define BENCH_UNIT  "cycles"    /* DWT CYCCNT core clock cycles */
+#endif
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS  1000  /* number of calls of every benchmarked function */
+#endif
+#define BENCH_MAX_RESULTS 16    /* max number of benchmark results */
+
+typedef struct
+{
+  const char* name;     /* benchmark name */
+  uint32_t iterations;  /* number of measured calls */
+  uint32_t items;       /* number of items (e.g. devices) processed per call */
+  uint64_t total;       /* total time of all calls [BENCH_UNIT] */
+} BENCH_Result_t;
+
+uint8_t BENCH_Run(BENCH_Result_t* pResults, uint8_t max_results);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*BENCHMARK_H */
@@ -8,6 +8,11 @@ extern "C" {
 
 #include "stm32wbxx_hal.h"
 
+#define COLOR_TEMP_MIN      100 /* shade skylight mireds */
+#define COLOR_TEMP_MAX      450 /* incandescent bulb mireds */
+#define COLOR_TEMP_LUT_STEP 5   /* mireds between color temperature table entries */
+#define COLOR_TEMP_LUT_SIZE ((COLOR_TEMP_MAX - COLOR_TEMP_MIN) / COLOR_TEMP_LUT_STEP + 1)
+
 typedef struct
 {
   uint8_t R;
@@ -29,7 +34,16 @@ typedef struct
 
 RGB_t convert_XY_to_RGB(XY_t color_xy);
 RGB_t convert_HS_to_RGB(HS_t color_hs);
+RGB_t convert_HSV_to_RGB(uint16_t enh_hue, uint8_t sat);
 XY_t convert_temp_to_XY(uint16_t color_temp);
+RGB_t convert_temp_to_RGB(uint16_t color_temp);
+float gamma_correction(float val2correct);
+uint8_t gamma_encode(float linear);
+
+/* generated by Host/Src/gen_color_temp_lut.c */
+extern const RGB_t color_temp_LUT[];
+/* generated by Host/Src/gen_gamma_lut.c */
+extern const float gamma_threshold[256];
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -0,0 +1,35 @@
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef PRNG_H
+#define PRNG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef PRNG_HOST_SEED
+#define PRNG_HOST_SEED  0x853C49E6748FEA9BULL   /* fixed seed of the host build for reproducible runs */
+#endif
+
+/* PCG32 generator; streams with different ids give independent sequences from the same seed */
+typedef struct
+{
+  uint64_t state;
+  uint64_t inc;     /* stream increment; always odd, 0 = the stream has not been seeded */
+} PRNG_Stream_t;
+
+uint64_t PRNG_HwSeed(void);
+void PRNG_Init(uint64_t seed);
+void PRNG_Seed(PRNG_Stream_t* pStream, uint32_t stream_id);
+uint32_t PRNG_Next(PRNG_Stream_t* pStream);
+uint32_t PRNG_Below(PRNG_Stream_t* pStream, uint32_t bound);
+void PRNG_Fill(PRNG_Stream_t* pStream, uint32_t* pBuffer, size_t count);
+uint32_t PRNG_Random(uint32_t bound);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*PRNG_H */
@@ -15,415 +15,3048 @@
 
 
 #include "WS2812A_driver.h"
+#include "animator.h"
+#include "prng.h"
 #include "main.h"
+#include "utilities_conf.h"
+#include "app_common.h"
 #include <string.h>
-#include <math.h>
-
-//#define GRB_ORDER   /* enable for GRB color order */
-#define WS2812A_NUMB_DEV  100     /* number of WS2812A devices in the strip */
-#define WS2812A_DEV_SIZE  15    /* number of bytes per WS2812A device (24 RGB bits * 5 pulse bits = 120 bits) */
-#define WS2812A_PULSE_BUF_SIZE  (WS2812A_NUMB_DEV * WS2812A_DEV_SIZE)   /* size of WS2812A pulse buffer */
-#define WS2812A_PULSE_ZERO  0x10    /* 5-bit SPI pulse creating device bit 0 */
-#define WS2812A_PULSE_ONE   0x1C    /* 5-bit SPI pulse creating device bit 1 */
+#include <stddef.h>
+#include <stdlib.h>
+
+#define WS2812A_LATCH_TIME  64    /* low state closing a frame and latching the data [us] */
+#define WS2812A_PULSE_BUF_SIZE(pStrip)  ((pStrip)->numb_rows * (pStrip)->dev_size + (pStrip)->latch_size)   /* size of WS2812A pulse buffer */
+#define WS2812A_NUMB_PULSE_BUF  2   /* number of pulse buffers used alternately for encoding and transmission */
+/* a half of the pulse ring (16 devices last about 480 us) is always longer than the latch */
+#define WS2812A_STREAM_HALF_SIZE(pStrip)  (WS2812A_STREAM_DEVS * (pStrip)->dev_size)  /* size of each half of the pulse ring of a streamed strip */
+#define WS2812A_STREAM_RING_SIZE(pStrip)  (2 * WS2812A_STREAM_HALF_SIZE(pStrip))  /* size of the pulse ring of a streamed strip */
+#define WS2812A_STREAM_SIZE(pStrip)  ((((pStrip)->numb_dev + WS2812A_STREAM_DEVS - 1) / WS2812A_STREAM_DEVS + 2) * WS2812A_STREAM_HALF_SIZE(pStrip))  /* max number of bytes streamed in a frame */
+#define WS2812A_PULSE5_ZERO  0x10   /* 5-bit SPI pulse creating device bit 0: 10000 */
+#define WS2812A_PULSE5_ONE   0x1C   /* 5-bit SPI pulse creating device bit 1: 11100 */
+#define WS2812A_PULSE4_ZERO  0x08   /* 4-bit SPI pulse creating device bit 0: 1000 */
+#define WS2812A_PULSE4_ONE   0x0E   /* 4-bit SPI pulse creating device bit 1: 1110 */
+#define WS2812A_PULSE3_ZERO  0x04   /* 3-bit SPI pulse creating device bit 0: 100 */
+#define WS2812A_PULSE3_ONE   0x06   /* 3-bit SPI pulse creating device bit 1: 110 */
+#define WS2812A_T0H_MIN  200    /* device timing tolerances of the WS2812 datasheet [ns]: bit 0 high time 350 +-150 ns */
+#define WS2812A_T0H_MAX  500
+#define WS2812A_T1H_MIN  550    /* bit 1 high time 700 +-150 ns */
+#define WS2812A_T1H_MAX  850
+#define WS2812A_TBIT_MIN  650   /* bit period 1250 +-600 ns */
+#define WS2812A_TBIT_MAX  1850
+#define WS2812A_TBIT  1250
 #define WS2812A_RGB_WHITE 0x7F  /* RGB value for the white color */
 #define MAX_SAT 0xFF
+#ifndef WS2812A_EFFECT_STATE_SIZE
+#define WS2812A_EFFECT_STATE_SIZE  160  /* size of the state arena shared by the color loop effects [B] */
+#endif
+#define WS2812A_MAX_PARTICLES  8   /* size of the particle pool of the comets effect */
+#define WS2812A_PARTICLE_TAIL  8   /* number of devices of a comet; the brightness halves toward its end */
+#define WS2812A_RANDOM_BUF_SIZE  8   /* number of random words generated at once for the effects */
+#define WS2812A_DEFAULT_EFFECT  2   /* index of the effect used until a color loop is set: cycling of all devices */
+#define WS2812A_NO_EFFECT  UINT8_MAX    /* no effect is running */
+#ifdef WS2812A_HOST_BUILD
+#define WS2812A_STAMP()  (HAL_GetTick() * 1000)     /* time stamp of the latency measurement: simulated time [us] */
+#define WS2812A_STAMP_PER_US  1
+#else
+#define WS2812A_STAMP()  (DWT->CYCCNT)      /* time stamp of the latency measurement: core clock cycles */
+#define WS2812A_STAMP_PER_US  (SystemCoreClock / 1000000)
+#endif
+#ifdef WS2812A_HOST_BUILD
+#define WS2812A_BARRIER()  __sync_synchronize()
+#else
+#define WS2812A_BARRIER()  __DMB()     /* orders the command queue accesses */
+#endif
+#define WS2812A_TS_TICKS(ms)  (((ms) * 1000 + CFG_TS_TICK_VAL - 1) / CFG_TS_TICK_VAL)   /* timer server ticks of at least the time [ms] */
+#ifndef WS2812A_REFRESH_INTERVAL
+#define WS2812A_REFRESH_INTERVAL  1000  /* interval of unchanged frame retransmission for glitch recovery [ms]; 0 disables it */
+#endif
+#ifdef WS2812A_INDEXED_COLORS
+#define WS2812A_NUMB_COLORS  256    /* entries of the palette of the device colors; all values of the 8-bit index */
+#endif
+
+#ifdef WS2812A_INDEXED_COLORS
+typedef uint8_t WS2812A_Pixel_t;    /* index of the device color in the palette */
+#else
+typedef RGB_t WS2812A_Pixel_t;      /* device color */
+#endif
+
+typedef struct
+{
+  uint8_t bits;               /* SPI bits per device bit; also pulse bytes per color byte */
+  uint8_t t0h_bits;           /* high SPI bits of device bit 0 */
+  uint8_t t1h_bits;           /* high SPI bits of device bit 1 */
+} WS2812A_Encoding_t;
+
+typedef struct
+{
+  SPI_HandleTypeDef* phSPI;   /* SPI driving the strip */
+  uint16_t first_dev;         /* index of the first strip device in the RGB buffer */
+  uint16_t numb_dev;          /* number of devices in the strip; in all lanes of a parallel output */
+  uint16_t numb_rows;         /* number of devices sent one after another: the strip devices or the devices of every lane */
+  WS2812A_ColorOrderTypeDef color_order;  /* order of colors expected by the strip devices */
+  WS2812A_EncodingTypeDef encoding;   /* SPI pulses of the device bits */
+  uint8_t dev_size;           /* number of pulse bytes per row of devices */
+  uint16_t latch_size;        /* number of zero bytes closing a frame */
+  uint32_t byte_rate;         /* rate of the pulse bytes sent by DMA [B/s] */
+#ifdef WS2812A_PARALLEL_OUTPUT
+  const WS2812A_ParallelConfig_t* pParallel;   /* lanes of a GPIO port; NULL for an SPI strip */
+#endif
+  uint8_t* pPulseBuffer[WS2812A_NUMB_PULSE_BUF];  /* ping-pong pulse buffers; latch bytes stay 0; the pulse ring of a streamed strip in [0] */
+  bool streaming;             /* the pulses are encoded into the ring in the DMA interrupts during the transmission */
+  uint16_t stream_dev;        /* next strip device to be encoded into the pulse ring */
+  uint8_t stream_zero;        /* number of latch halves encoded into the pulse ring after the last device */
+  volatile uint8_t tx_buffer_index;   /* index of the buffer owned by SPI DMA */
+  volatile bool tx_busy;      /* SPI DMA is streaming the buffer tx_buffer_index */
+  volatile bool tx_pending;   /* the other buffer holds a frame waiting for the end of current transmission */
+  uint16_t dirty_first[WS2812A_NUMB_PULSE_BUF];   /* first strip device changed since the buffer was encoded */
+  uint16_t dirty_last[WS2812A_NUMB_PULSE_BUF];    /* last strip device changed since the buffer was encoded; < first if none */
+} WS2812A_Strip_t;
+
+typedef enum
+{
+  WS2812A_SPACE_RGB,    /* transition components are R, G, B */
+  WS2812A_SPACE_XY      /* transition components are X, Y */
+} WS2812A_ColorSpaceTypeDef;
+
+typedef struct
+{
+  bool active;                        /* transition in progress */
+  WS2812A_ColorSpaceTypeDef space;    /* color space of the interpolation; the components are animator channels */
+  bool xy_at_end;                     /* the XY color is known when the transition ends */
+} WS2812A_ColorTransition_t;
+
+typedef struct
+{
+  void (*init)(void* pState, const WS2812A_EffectParams_t* pParams);    /* starts the effect with a zeroed state */
+  void (*render)(void* pState, const WS2812A_EffectParams_t* pParams);  /* sets the devices in every frame */
+  void (*param)(void* pState, const WS2812A_EffectParams_t* pParams);   /* applies changed parameters; NULL if not needed */
+  uint32_t (*step_time)(const void* pState, const WS2812A_EffectParams_t* pParams);  /* returns the time of one visible change [ms] */
+  WS2812A_EffectParams_t params;    /* default parameters */
+} WS2812A_Effect_t;
+
+typedef struct
+{
+  uint16_t numb_entries;    /* palette entries of the groups cycled instead of their devices; 0 if the devices are set */
+} WS2812A_CyclingState_t;
+
+typedef struct
+{
+  RGB_t color_rgb_start;    /* color of the active group at the start of the fade */
+  RGB_t color_rgb_target;
+  uint16_t group_active;
+} WS2812A_RandomState_t;
+
+typedef struct
+{
+  uint16_t position;    /* number of steps made since the start of the effect, modulo 2^16 */
+} WS2812A_CometState_t;
+
+typedef struct
+{
+  uint32_t start_tick;  /* tick of the comet start at the end of the strip [ms] */
+  uint32_t travel_time; /* time of the travel along the strip [ms] */
+  int16_t head;         /* device of the comet head drawn in the previous frame */
+  RGB_t color;          /* color of the comet head */
+  bool active;
+} WS2812A_Particle_t;
+
+typedef struct
+{
+  WS2812A_Particle_t particles[WS2812A_MAX_PARTICLES];
+} WS2812A_ParticleState_t;
+
+typedef struct
+{
+  const WS2812A_Asset_t* pAsset;    /* asset played by the effect */
+  const uint8_t* pRecord;   /* delta record of the next frame */
+  uint16_t frame;           /* index of the next frame */
+  uint32_t next_tick;       /* tick of the next frame [ms] */
+} WS2812A_PlaybackState_t;
+
+typedef struct
+{
+  uint8_t first_hue;    /* hue of the palette start */
+  uint16_t hue_span;    /* number of hues in the palette; 0x100 = full circle */
+} WS2812A_Palette_t;
+
+/* byte offsets of the transmitted colors in RGB_t for every color order */
+static const uint8_t WS2812A_color_offset[WS2812A_NUMB_ORDERS][3] =
+{
+  [WS2812A_ORDER_RGB] = { offsetof(RGB_t, R), offsetof(RGB_t, G), offsetof(RGB_t, B) },
+  [WS2812A_ORDER_RBG] = { offsetof(RGB_t, R), offsetof(RGB_t, B), offsetof(RGB_t, G) },
+  [WS2812A_ORDER_GRB] = { offsetof(RGB_t, G), offsetof(RGB_t, R), offsetof(RGB_t, B) },
+  [WS2812A_ORDER_GBR] = { offsetof(RGB_t, G), offsetof(RGB_t, B), offsetof(RGB_t, R) },
+  [WS2812A_ORDER_BRG] = { offsetof(RGB_t, B), offsetof(RGB_t, R), offsetof(RGB_t, G) },
+  [WS2812A_ORDER_BGR] = { offsetof(RGB_t, B), offsetof(RGB_t, G), offsetof(RGB_t, R) }
+};
+
+static void WS2812A_cycling_init(void* pState, const WS2812A_EffectParams_t* pParams);
+static void WS2812A_cycling_render(void* pState, const WS2812A_EffectParams_t* pParams);
+static void WS2812A_random_init(void* pState, const WS2812A_EffectParams_t* pParams);
+static void WS2812A_random_render(void* pState, const WS2812A_EffectParams_t* pParams);
+static void WS2812A_comet_init(void* pState, const WS2812A_EffectParams_t* pParams);
+static void WS2812A_comet_render(void* pState, const WS2812A_EffectParams_t* pParams);
+static void WS2812A_comet_param(void* pState, const WS2812A_EffectParams_t* pParams);
+static void WS2812A_particles_init(void* pState, const WS2812A_EffectParams_t* pParams);
+static void WS2812A_particles_render(void* pState, const WS2812A_EffectParams_t* pParams);
+static uint32_t WS2812A_cycling_step_time(const void* pState, const WS2812A_EffectParams_t* pParams);
+static uint32_t WS2812A_random_step_time(const void* pState, const WS2812A_EffectParams_t* pParams);
+static uint32_t WS2812A_comet_step_time(const void* pState, const WS2812A_EffectParams_t* pParams);
+static uint32_t WS2812A_particles_step_time(const void* pState, const WS2812A_EffectParams_t* pParams);
+static void WS2812A_playback_init(void* pState, const WS2812A_EffectParams_t* pParams);
+static void WS2812A_playback_render(void* pState, const WS2812A_EffectParams_t* pParams);
+static uint32_t WS2812A_playback_step_time(const void* pState, const WS2812A_EffectParams_t* pParams);
+
+/* registry of the color loop effects selected by index; the initial entries follow the former loop modes */
+static const WS2812A_Effect_t WS2812A_effects[] =
+{
+  { WS2812A_cycling_init, WS2812A_cycling_render, WS2812A_cycling_init, WS2812A_cycling_step_time, { .speed = 10000, .use_groups = true } },
+  { WS2812A_cycling_init, WS2812A_cycling_render, WS2812A_cycling_init, WS2812A_cycling_step_time, { .speed = 60000, .use_groups = true } },
+  { WS2812A_cycling_init, WS2812A_cycling_render, WS2812A_cycling_init, WS2812A_cycling_step_time, { .speed = 10000, .use_groups = false } },
+  { WS2812A_cycling_init, WS2812A_cycling_render, WS2812A_cycling_init, WS2812A_cycling_step_time, { .speed = 60000, .use_groups = false } },
+  { WS2812A_random_init, WS2812A_random_render, NULL, WS2812A_random_step_time, { .speed = 500, .use_groups = true } },
+  { WS2812A_random_init, WS2812A_random_render, NULL, WS2812A_random_step_time, { .speed = 10000, .use_groups = true } },
+  { WS2812A_random_init, WS2812A_random_render, NULL, WS2812A_random_step_time, { .speed = 5000, .use_groups = false } },
+  { WS2812A_random_init, WS2812A_random_render, NULL, WS2812A_random_step_time, { .speed = 60000, .use_groups = false } },
+  { WS2812A_comet_init, WS2812A_comet_render, WS2812A_comet_param, WS2812A_comet_step_time, { .speed = 1000, .density = 3000 } },
+  { WS2812A_comet_init, WS2812A_comet_render, WS2812A_comet_param, WS2812A_comet_step_time, { .speed = 1000, .density = 10000 } },
+  { WS2812A_particles_init, WS2812A_particles_render, NULL, WS2812A_particles_step_time, { .speed = 2000, .density = 500 } },
+  { WS2812A_particles_init, WS2812A_particles_render, NULL, WS2812A_particles_step_time, { .speed = 4000, .density = 2000 } }
+};
+#define WS2812A_NUMB_EFFECTS  (sizeof(WS2812A_effects) / sizeof(WS2812A_effects[0]))
+
+/* effect of the indexes following the registry; it plays the animation asset of the index */
+static const WS2812A_Effect_t WS2812A_playback = { WS2812A_playback_init, WS2812A_playback_render, NULL, WS2812A_playback_step_time, { 0 } };
+
+static const WS2812A_Encoding_t WS2812A_encodings[WS2812A_NUMB_ENCODINGS] =
+{
+  [WS2812A_ENCODING_5BIT] = { 5, 1, 3 },
+  [WS2812A_ENCODING_4BIT] = { 4, 1, 3 },
+  [WS2812A_ENCODING_3BIT] = { 3, 1, 2 }
+};
+
+static const WS2812A_Palette_t WS2812A_palettes[WS2812A_NUMB_PALETTES] =
+{
+  [WS2812A_PALETTE_RAINBOW] = { 0x00, 0x100 },
+  [WS2812A_PALETTE_WARM] = { 0x00, 0x2B },
+  [WS2812A_PALETTE_COOL] = { 0x55, 0x56 }
+};
+
+static PRNG_Stream_t effect_streams[WS2812A_NUMB_EFFECTS];    /* random number streams of the effects */
+
+/* state of the running effect; every effect state must fit in it */
+static uint32_t effect_arena[WS2812A_EFFECT_STATE_SIZE / sizeof(uint32_t)];
+_Static_assert(sizeof(WS2812A_CyclingState_t) <= sizeof(effect_arena), "cycling effect state exceeds the arena");
+_Static_assert(sizeof(WS2812A_RandomState_t) <= sizeof(effect_arena), "random effect state exceeds the arena");
+_Static_assert(sizeof(WS2812A_CometState_t) <= sizeof(effect_arena), "comet effect state exceeds the arena");
+_Static_assert(sizeof(WS2812A_ParticleState_t) <= sizeof(effect_arena), "particle pool exceeds the arena");
+_Static_assert(sizeof(WS2812A_PlaybackState_t) <= sizeof(effect_arena), "playback effect state exceeds the arena");
+
+static uint32_t WS2812A_pool[WS2812A_POOL_SIZE / sizeof(uint32_t)];   /* memory pool for the strip buffers */
+static size_t pool_used = 0;    /* number of pool bytes allocated */
+static WS2812A_Strip_t WS2812A_strips[WS2812A_MAX_STRIPS];
+static uint8_t number_of_strips = 0;    /* number of strips driven simultaneously */
+static uint16_t number_of_devices = 0;  /* number of devices in all strips */
+static WS2812A_Stats_t WS2812A_stats;       /* frame transmission statistics */
+static WS2812A_Pixel_t* WS2812A_RGB_data;  /* colors (or palette indexes) of the devices of all strips; a ring starting at ring_head */
+#ifdef WS2812A_INDEXED_COLORS
+static RGB_t device_palette[WS2812A_NUMB_COLORS];   /* device colors referenced by the indexes */
+static uint16_t palette_users[WS2812A_NUMB_COLORS]; /* number of devices of every palette entry; 0 = free entry */
+static uint8_t palette_hash[WS2812A_NUMB_COLORS];   /* palette entry last given a color of the hash value */
+static uint8_t palette_cursor = 0;  /* palette entry the search for a free entry starts at */
+#endif
+static uint16_t ring_head = 0;      /* index of the color of the first device in WS2812A_RGB_data; moved by scrolling */
+static uint16_t level_current = 0;   /* current light level in Q8.8 format <0,255.0> */
+static uint8_t level_started = 0;    /* target of the last level transition */
+static uint32_t level_remaining = 0; /* remaining level transition time reported in light_params [ms] */
+static uint32_t frame_tick = 0;      /* tick of the current frame [ms] */
+static uint32_t frame_elapsed = 0;   /* time since the previous frame [ms] */
+static uint32_t frame_interval = 0;  /* interval of the frame clock [ms]; 0 = stopped */
+static uint32_t frame_interval_min = WS2812A_FRAME_INTERVAL_MIN;  /* shortest frame interval allowed by the strip transmission [ms] */
+static uint8_t frame_timer_id;       /* timer server timer of the frame clock */
+static bool frame_clock_created = false;
+static bool frame_requested = false;   /* a frame has been requested by a command and has not run yet */
+static uint32_t request_stamp;         /* time stamp of the first command served by the requested frame */
+static WS2812A_Command_t command_queue[WS2812A_QUEUE_SIZE];    /* commands posted by the application */
+static volatile uint32_t queue_head = 0;    /* number of commands posted; written by the producer only */
+static volatile uint32_t queue_tail = 0;    /* number of commands applied; written by the frame task only */
+static volatile bool latency_pending = false;  /* the DMA start of the next frame ends the latency measurement */
+static uint32_t latency_stamp;         /* time stamp of the command of the pending latency measurement */
+static volatile uint8_t streams_busy = 0;      /* number of streamed strips in transmission */
+static volatile bool frame_postponed = false;  /* a frame waits for the end of the streamed transmissions */
+static uint8_t level_corrected = 0;  /* perceptually corrected level the scale table is built for */
+static uint8_t level_scale[256];     /* color values scaled by the corrected level */
+static uint16_t dirty_first = UINT16_MAX;   /* first device changed since the last transmission */
+static uint16_t dirty_last = 0;             /* last device changed since the last transmission; < dirty_first if none */
+static uint32_t last_transmit_tick = 0;   /* tick of the last frame transmission */
+static uint16_t* group_size; /* number of devices in groups, number of groups <= number of devices */
+static uint16_t number_of_groups = 0;   /* number of groups */
+static uint8_t effect_running = WS2812A_NO_EFFECT;  /* index of the running effect; used for effect change detection */
+static uint32_t random_buffer[WS2812A_RANDOM_BUF_SIZE];   /* random words of the running effect */
+static uint8_t random_used = WS2812A_RANDOM_BUF_SIZE;     /* number of random words used from the buffer */
+static WS2812A_ColorTransition_t color_transition = { .active = false };    /* global color transition */
+static XY_t color_xy_current;           /* current global color in XY space */
+static bool color_xy_valid = false;     /* the current global color is known in XY space */
+static uint16_t remaining_time_reported = 0;    /* the last reported remaining transition time [1/10 s] */
+static bool color_hs_valid = false;     /* the current global color is known in HS space */
+static bool hs_settled = true;          /* hue and saturation are not changing */
+static uint32_t hs_fade_time = 0;       /* fade time from a color unknown in HS space [ms] */
+static bool color_temp_valid = false;   /* the current global color is a color temperature */
+static bool temp_settled = true;        /* the color temperature is not changing */
+static uint32_t temp_fade_time = 0;     /* fade time from a color other than a color temperature [ms] */
+
+Light_Params_t light_params =
+{
+    .level_target = 0,
+    .level_on = WS2812A_START_ON_LEVEL,
+    .transition_time = 0,
+    .color_transition_time = 0,
+    .set_color_XY = false,
+    .set_color_HS = false,
+    .set_color_temp = false,
+    .color_restore = false,
+    .color_mode = COLOR_STATIC,
+    .effect = WS2812A_DEFAULT_EFFECT,
+    .color_rgb = {WS2812A_RGB_WHITE, WS2812A_RGB_WHITE, WS2812A_RGB_WHITE}
+};
+
+void WS2812A_encode(const RGB_t* pRGB, size_t numb_dev, const uint8_t* pScale, WS2812A_ColorOrderTypeDef color_order, WS2812A_EncodingTypeDef encoding, uint8_t* pBuffer);
+static inline uint16_t WS2812A_ring_index(uint16_t dev_index);
+static inline const RGB_t* WS2812A_ring_color(uint16_t index);
+static inline RGB_t WS2812A_get_device(uint16_t dev_index);
+static inline void WS2812A_mark_device(uint16_t dev_index);
+static inline void WS2812A_set_device(uint16_t dev_index, RGB_t color);
+#ifdef WS2812A_INDEXED_COLORS
+void WS2812A_encode_indexed(const uint8_t* pIndex, size_t numb_dev, const RGB_t* pPalette, const uint8_t* pScale, WS2812A_ColorOrderTypeDef color_order,
+                            WS2812A_EncodingTypeDef encoding, uint8_t* pBuffer);
+static inline uint8_t WS2812A_color_hash(RGB_t color);
+static uint8_t WS2812A_new_color(RGB_t color);
+static void WS2812A_set_device_index(uint16_t dev_index, uint8_t index);
+static void WS2812A_set_palette(uint8_t index, RGB_t color);
+static void WS2812A_reset_palette(uint8_t index, RGB_t color);
+#endif
+static void WS2812A_scroll(void);
+static void WS2812A_encode_strip(const WS2812A_Strip_t* pStrip, uint16_t first, uint16_t last, uint8_t* pBuffer);
+static void WS2812A_set_devices(uint16_t first_dev, uint16_t numb_dev, RGB_t color);
+static void WS2812A_mark_buffers(bool all_devices);
+static uint8_t WS2812A_correct_level(uint16_t level);
+static void WS2812A_build_scale(uint8_t level);
+static RGB_t WS2812A_palette_color(WS2812A_PaletteTypeDef palette, uint8_t position);
+static const WS2812A_Effect_t* WS2812A_get_effect(uint8_t index);
+static uint32_t WS2812A_read_number(const uint8_t** ppData);
+static const uint8_t* WS2812A_play_frame(const uint8_t* pRecord);
+static uint32_t WS2812A_random(uint32_t bound);
+static void* WS2812A_alloc(size_t size);
+static uint8_t WS2812A_acquire_buffer(WS2812A_Strip_t* pStrip);
+static void WS2812A_transmit(WS2812A_Strip_t* pStrip, uint8_t buffer_index);
+static void WS2812A_start_DMA(WS2812A_Strip_t* pStrip, uint8_t buffer_index);
+static void WS2812A_stream_fill(WS2812A_Strip_t* pStrip, uint8_t* pHalf);
+static void WS2812A_stream_next(WS2812A_Strip_t* pStrip, uint8_t* pHalf);
+static void WS2812A_stream_end(WS2812A_Strip_t* pStrip);
+static WS2812A_Strip_t* WS2812A_find_strip(SPI_HandleTypeDef* phSPI);
+static void WS2812A_start_color_transition(XY_t target_xy, uint32_t transition_time);
+static void WS2812A_stop_color_transition(void);
+static void WS2812A_step_color_transition(void);
+static void WS2812A_report_remaining_time(void);
+static void WS2812A_start_rgb_transition(RGB_t target_rgb, uint32_t transition_time);
+static void WS2812A_start_channel(ANIM_ChannelTypeDef channel, int32_t change, uint32_t transition_time);
+static void WS2812A_stop_hue_sat(void);
+static void WS2812A_step_hue_sat(void);
+static inline bool WS2812A_hs_active(void);
+static uint16_t WS2812A_start_temp(uint16_t temp_min, uint16_t temp_max);
+static void WS2812A_step_temp(void);
+static uint32_t WS2812A_spi_clock(const SPI_HandleTypeDef* phSPI);
+static uint32_t WS2812A_select_prescaler(uint32_t spi_clock, const WS2812A_Encoding_t* pEncoding);
+static bool WS2812A_config_spi(WS2812A_Strip_t* pStrip, uint32_t* pPrescaler);
+static void WS2812A_tx_complete(WS2812A_Strip_t* pStrip);
+#ifdef WS2812A_PARALLEL_OUTPUT
+static uint32_t WS2812A_timer_clock(const TIM_HandleTypeDef* phTIM);
+static bool WS2812A_config_parallel(WS2812A_Strip_t* pStrip, uint32_t* pPeriod);
+static void WS2812A_setup_parallel(WS2812A_Strip_t* pStrip, uint32_t period);
+static void WS2812A_prepare_slots(const WS2812A_Strip_t* pStrip, uint8_t* pBuffer);
+static void WS2812A_encode_lanes(const WS2812A_Strip_t* pStrip, uint16_t first, uint16_t last, uint8_t* pBuffer);
+static void WS2812A_stop_parallel(WS2812A_Strip_t* pStrip);
+static WS2812A_Strip_t* WS2812A_find_parallel(DMA_HandleTypeDef* phDMA);
+static void WS2812A_parallel_complete(DMA_HandleTypeDef* phDMA);
+static void WS2812A_parallel_error(DMA_HandleTypeDef* phDMA);
+#endif
+static void WS2812A_frame_clock(void);
+static void WS2812A_set_frame_interval(uint32_t interval);
+static uint32_t WS2812A_needed_interval(void);
+static void WS2812A_request_frame(void);
+static void WS2812A_apply_commands(void);
+static bool WS2812A_supersedes(const WS2812A_Command_t* pNewer, const WS2812A_Command_t* pOlder);
+static void WS2812A_execute(const WS2812A_Command_t* pCommand);
+static void WS2812A_level_step(uint8_t mode, uint8_t size, uint32_t transition_time);
+static void WS2812A_loop_start(int8_t effect_step, uint8_t effect, uint8_t direction);
+static void WS2812A_brightness_move(uint8_t mode, uint8_t rate);
+static void WS2812A_hue_sat_move_to(uint8_t components, uint16_t enh_hue, uint8_t sat, WS2812A_HueDirTypeDef direction, uint32_t transition_time);
+static void WS2812A_hue_sat_move(uint8_t components, int32_t rate);
+static void WS2812A_hue_sat_step(uint8_t components, int32_t step, uint32_t transition_time);
+static void WS2812A_color_temp_move_to(uint16_t color_temp, uint32_t transition_time);
+static void WS2812A_color_temp_move(int32_t rate, uint16_t temp_min, uint16_t temp_max);
+static void WS2812A_color_temp_step(int32_t step, uint32_t transition_time, uint16_t temp_min, uint16_t temp_max);
+static void WS2812A_color_move_stop(void);
+
+/**
+ * @brief Initialize the driver for the given set of strips.
+ *
+ * @param pStripConfig  Array of strip configurations; the devices of all strips form one continuous RGB buffer
+ *                      in the order of the array.
+ * @param numb_strips   Number of strips (1..WS2812A_MAX_STRIPS).
+ * @return true if every strip has its SPI or parallel output handle, the buffers of all strips have been allocated
+ *         from the memory pool, the TX DMA mode of every strip suits its streaming option
+ *         and the SPI clock of every strip gives its encoding within the device timing tolerances.
+ *
+ * @note The SPI prescaler is set by the driver for the encoding of the strip.
+ * @note All strips are validated before any driver state is set; the driver stays uninitialized on failure
+ *       and the SPIs keep their prescalers.
+ * @note All memory is allocated once here; the function must not be called again.
+ *       Every device forms its own group until WS2812A_SetGroups() is called.
+ */
+bool WS2812A_Init(const WS2812A_StripConfig_t* pStripConfig, uint8_t numb_strips)
+{
+  uint8_t strip;
+  uint8_t buffer_index;
+  size_t pool_required = 0;
+  uint32_t divider[WS2812A_MAX_STRIPS];     /* SPI prescaler or timer period selected for the strips */
+  WS2812A_Strip_t strips[WS2812A_MAX_STRIPS];   /* strips being validated; copied to WS2812A_strips when all of them are valid */
+
+  if((pStripConfig == NULL) || (numb_strips == 0) || (numb_strips > WS2812A_MAX_STRIPS) || (number_of_strips != 0))
+  {
+    return false;
+  }
+
+  /* check the strip timing, the total strip length and the memory required */
+  uint32_t total_dev = 0;
+  memset(strips, 0, sizeof(strips));
+  for(strip = 0; strip < numb_strips; strip++)
+  {
+    WS2812A_Strip_t* pStrip = &strips[strip];
+    if((pStripConfig[strip].numb_dev == 0) || (pStripConfig[strip].color_order >= WS2812A_NUMB_ORDERS) ||
+       (pStripConfig[strip].encoding >= WS2812A_NUMB_ENCODINGS))
+    {
+      return false;
+    }
+    pStrip->numb_dev = pStripConfig[strip].numb_dev;
+    pStrip->numb_rows = pStripConfig[strip].numb_dev;
+    pStrip->color_order = pStripConfig[strip].color_order;
+    pStrip->encoding = pStripConfig[strip].encoding;
+    pStrip->streaming = pStripConfig[strip].streaming;
+#ifdef WS2812A_PARALLEL_OUTPUT
+    pStrip->pParallel = pStripConfig[strip].pParallel;
+    if(pStrip->pParallel != NULL)
+    {
+      if(!WS2812A_config_parallel(pStrip, &divider[strip]))
+      {
+        return false;
+      }
+    }
+    else
+#endif
+    {
+      pStrip->phSPI = pStripConfig[strip].phSPI;
+      if(!WS2812A_config_spi(pStrip, &divider[strip]))
+      {
+        return false;
+      }
+    }
+    pStrip->latch_size = (uint16_t)(((uint64_t)WS2812A_LATCH_TIME * pStrip->byte_rate + 1000000 - 1) / 1000000);
+    total_dev += pStrip->numb_dev;
+    if(pStrip->streaming)
+    {
+      pool_required += WS2812A_STREAM_RING_SIZE(pStrip);
+    }
+    else
+    {
+      /* the DMA transfer size is 16-bit */
+      if((uint32_t)WS2812A_PULSE_BUF_SIZE(pStrip) > UINT16_MAX)
+      {
+        return false;
+      }
+      pool_required += WS2812A_NUMB_PULSE_BUF * ((WS2812A_PULSE_BUF_SIZE(pStrip) + 3) & ~3);
+    }
+  }
+  pool_required += ((total_dev * sizeof(WS2812A_Pixel_t) + 3) & ~3) + ((total_dev * sizeof(uint16_t) + 3) & ~3);
+  if((total_dev > UINT16_MAX) || (pool_required > sizeof(WS2812A_pool)))
+  {
+    return false;
+  }
+
+  /* set the SPI prescalers of the encodings; on failure the SPIs changed so far get their previous prescalers back */
+  uint32_t previous[WS2812A_MAX_STRIPS];    /* SPI prescalers before the initialization */
+  for(strip = 0; strip < numb_strips; strip++)
+  {
+    SPI_HandleTypeDef* phSPI = strips[strip].phSPI;
+    if((phSPI != NULL) && (phSPI->Init.BaudRatePrescaler != divider[strip]))
+    {
+      previous[strip] = phSPI->Init.BaudRatePrescaler;
+      phSPI->Init.BaudRatePrescaler = divider[strip];
+      if(HAL_SPI_Init(phSPI) != HAL_OK)
+      {
+        do
+        {
+          phSPI = strips[strip].phSPI;
+          if((phSPI != NULL) && (phSPI->Init.BaudRatePrescaler != previous[strip]))
+          {
+            phSPI->Init.BaudRatePrescaler = previous[strip];
+            HAL_SPI_Init(phSPI);
+          }
+        } while(strip-- > 0);
+        return false;
+      }
+    }
+    else
+    {
+      previous[strip] = divider[strip];
+    }
+  }
+
+  /* allocate buffers */
+  memcpy(WS2812A_strips, strips, numb_strips * sizeof(WS2812A_Strip_t));
+  number_of_devices = (uint16_t)total_dev;
+  WS2812A_RGB_data = WS2812A_alloc(number_of_devices * sizeof(WS2812A_Pixel_t));
+  group_size = WS2812A_alloc(number_of_devices * sizeof(uint16_t));
+  uint16_t first_dev = 0;
+  for(strip = 0; strip < numb_strips; strip++)
+  {
+    WS2812A_Strip_t* pStrip = &WS2812A_strips[strip];
+    pStrip->first_dev = first_dev;
+#ifdef WS2812A_PARALLEL_OUTPUT
+    if(pStrip->pParallel != NULL)
+    {
+      WS2812A_setup_parallel(pStrip, divider[strip]);
+    }
+#endif
+    if(pStrip->streaming)
+    {
+      /* the pulse memory of a streamed strip does not depend on its length */
+      pStrip->pPulseBuffer[0] = WS2812A_alloc(WS2812A_STREAM_RING_SIZE(pStrip));
+      pStrip->pPulseBuffer[1] = NULL;
+    }
+    else
+    {
+      for(buffer_index = 0; buffer_index < WS2812A_NUMB_PULSE_BUF; buffer_index++)
+      {
+        pStrip->pPulseBuffer[buffer_index] = WS2812A_alloc(WS2812A_PULSE_BUF_SIZE(pStrip));
+#ifdef WS2812A_PARALLEL_OUTPUT
+        if(pStrip->pParallel != NULL)
+        {
+          WS2812A_prepare_slots(pStrip, pStrip->pPulseBuffer[buffer_index]);
+        }
+#endif
+      }
+    }
+    pStrip->tx_buffer_index = WS2812A_NUMB_PULSE_BUF - 1;
+    pStrip->tx_busy = false;
+    pStrip->tx_pending = false;
+    for(buffer_index = 0; buffer_index < WS2812A_NUMB_PULSE_BUF; buffer_index++)
+    {
+      /* every buffer must be fully encoded before its first transmission */
+      pStrip->dirty_first[buffer_index] = 0;
+      pStrip->dirty_last[buffer_index] = pStrip->numb_rows - 1;
+    }
+    first_dev += pStrip->numb_dev;
+
+    /* a frame cannot start before the previous one with its latch has been transmitted */
+    uint32_t tx_size = pStrip->streaming ? WS2812A_STREAM_SIZE(pStrip) : WS2812A_PULSE_BUF_SIZE(pStrip);
+    uint32_t tx_time = (uint32_t)(((uint64_t)tx_size * 1000 + pStrip->byte_rate - 1) / pStrip->byte_rate);
+    if(tx_time > frame_interval_min)
+    {
+      frame_interval_min = tx_time;
+    }
+  }
+  number_of_strips = numb_strips;
+
+  /* initialize RGB buffer with white color values */
+#ifdef WS2812A_INDEXED_COLORS
+  WS2812A_reset_palette(0, (RGB_t){ WS2812A_RGB_WHITE, WS2812A_RGB_WHITE, WS2812A_RGB_WHITE });
+#else
+  memset(WS2812A_RGB_data, WS2812A_RGB_WHITE, number_of_devices * sizeof(RGB_t));
+#endif
+
+  /* define groups */
+  uint16_t group;
+  number_of_groups = number_of_devices;
+  for(group = 0; group < number_of_groups; group++)
+  {
+    group_size[group] = 1;
+  }
+
+  ANIM_Set(ANIM_SAT, (uint32_t)WS2812A_MAX_SAT << 16);
+
+#ifndef WS2812A_HOST_BUILD
+  /* the cycle counter measures the command latency */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  /* register WS2812A handler task */
+  UTIL_SEQ_RegTask(WS2812A_TASK, 0, WS2812A_handler);
+
+  return true;
+}
+
+/**
+ * @brief Set the layout of device groups used by the color loop effects.
+ *
+ * @param pGroupSize    Array of numbers of devices in the consecutive groups.
+ * @param numb_groups   Number of groups.
+ * @return true if the layout fits in the strips and has been applied.
+ */
+bool WS2812A_SetGroups(const uint16_t* pGroupSize, uint16_t numb_groups)
+{
+  uint32_t total_dev = 0;
+  uint16_t group;
+
+  if((numb_groups == 0) || (numb_groups > number_of_devices))
+  {
+    return false;
+  }
+
+  for(group = 0; group < numb_groups; group++)
+  {
+    total_dev += pGroupSize[group];
+  }
+  if(total_dev > number_of_devices)
+  {
+    return false;
+  }
+
+  memcpy(group_size, pGroupSize, numb_groups * sizeof(uint16_t));
+  number_of_groups = numb_groups;
+  /* force reinitialization of the current color loop */
+  effect_running = WS2812A_NO_EFFECT;
+
+  return true;
+}
+
+/* returns the number of effects in the registry and of the animation assets played after them */
+uint8_t WS2812A_GetNumbEffects(void)
+{
+  return WS2812A_NUMB_EFFECTS + WS2812A_numb_assets;
+}
+
+/* returns the number of devices in all strips */
+uint16_t WS2812A_GetNumbDev(void)
+{
+  return number_of_devices;
+}
+
+/**
+ * @brief Start the frame clock triggering the handler task.
+ *
+ * @note Must be called after the timer server has been initialized.
+ *       The clock runs at the rate required by the running transitions and effects;
+ *       it stops, or triggers only the refresh frames, while the strip is static.
+ */
+void WS2812A_StartClock(void)
+{
+  if(frame_clock_created)
+  {
+    return;
+  }
+  if(HW_TS_Create(CFG_TIM_PROC_ID_ISR, &frame_timer_id, hw_ts_Repeated, WS2812A_frame_clock) == hw_ts_Successful)
+  {
+    frame_clock_created = true;
+    WS2812A_set_frame_interval(frame_interval_min);
+  }
+}
+
+/**
+ * @brief Post a command to the light engine.
+ *
+ * @param pCommand  Command copied to the queue.
+ * @return true if the command has been queued; false if the queue is full.
+ *
+ * @note The queue has a single producer: the commands must be posted from one task.
+ *       The frame task applies all queued commands at the start of the next frame, which is requested at once;
+ *       a command superseded by the next one of the same kind is skipped.
+ */
+bool WS2812A_PostCommand(const WS2812A_Command_t* pCommand)
+{
+  uint32_t head = queue_head;
+
+  if((number_of_strips == 0) || (head - queue_tail >= WS2812A_QUEUE_SIZE))
+  {
+    WS2812A_stats.commands_dropped++;
+    return false;
+  }
+  command_queue[head % WS2812A_QUEUE_SIZE] = *pCommand;
+  /* the command is written before it is published */
+  WS2812A_BARRIER();
+  queue_head = head + 1;
+  WS2812A_request_frame();
+
+  return true;
+}
+
+/* sets the frame task at once; the requests made before the frame runs are served by it
+   and the time from the first one to the DMA start of the frame is measured */
+static void WS2812A_request_frame(void)
+{
+  if(!frame_requested)
+  {
+    frame_requested = true;
+    request_stamp = WS2812A_STAMP();
+    UTIL_SEQ_SetTask(WS2812A_TASK, 1);
+  }
+}
+
+/* allocates 4-byte aligned zeroed memory from the pool; NULL if the pool is exhausted */
+static void* WS2812A_alloc(size_t size)
+{
+  size = (size + 3) & ~3;
+  if(size > sizeof(WS2812A_pool) - pool_used)
+  {
+    return NULL;
+  }
+
+  void* pMemory = (uint8_t*)WS2812A_pool + pool_used;
+  pool_used += size;
+  return pMemory;
+}
+
+/* pulse pattern of a color byte: 8 w-bit pulses, MSB first */
+#define PULSE_BIT(v, n, zero, one)  ((((v) >> (n)) & 1) ? (uint64_t)(one) : (uint64_t)(zero))
+#define PULSE_PATTERN(v, w, zero, one)  ((PULSE_BIT(v, 7, zero, one) << (7 * (w))) | (PULSE_BIT(v, 6, zero, one) << (6 * (w))) | \
+                                         (PULSE_BIT(v, 5, zero, one) << (5 * (w))) | (PULSE_BIT(v, 4, zero, one) << (4 * (w))) | \
+                                         (PULSE_BIT(v, 3, zero, one) << (3 * (w))) | (PULSE_BIT(v, 2, zero, one) << (2 * (w))) | \
+                                         (PULSE_BIT(v, 1, zero, one) << (w)) | PULSE_BIT(v, 0, zero, one))
+#define PULSE_BYTE(v, w, zero, one, n)  (uint8_t)(PULSE_PATTERN(v, w, zero, one) >> (8 * (n)))
+#define PULSE_ENTRY5(v)   { PULSE_BYTE(v, 5, WS2812A_PULSE5_ZERO, WS2812A_PULSE5_ONE, 4), PULSE_BYTE(v, 5, WS2812A_PULSE5_ZERO, WS2812A_PULSE5_ONE, 3), \
+                            PULSE_BYTE(v, 5, WS2812A_PULSE5_ZERO, WS2812A_PULSE5_ONE, 2), PULSE_BYTE(v, 5, WS2812A_PULSE5_ZERO, WS2812A_PULSE5_ONE, 1), \
+                            PULSE_BYTE(v, 5, WS2812A_PULSE5_ZERO, WS2812A_PULSE5_ONE, 0) }
+#define PULSE_ENTRY4(v)   { PULSE_BYTE(v, 4, WS2812A_PULSE4_ZERO, WS2812A_PULSE4_ONE, 3), PULSE_BYTE(v, 4, WS2812A_PULSE4_ZERO, WS2812A_PULSE4_ONE, 2), \
+                            PULSE_BYTE(v, 4, WS2812A_PULSE4_ZERO, WS2812A_PULSE4_ONE, 1), PULSE_BYTE(v, 4, WS2812A_PULSE4_ZERO, WS2812A_PULSE4_ONE, 0) }
+#define PULSE_ENTRY3(v)   { PULSE_BYTE(v, 3, WS2812A_PULSE3_ZERO, WS2812A_PULSE3_ONE, 2), PULSE_BYTE(v, 3, WS2812A_PULSE3_ZERO, WS2812A_PULSE3_ONE, 1), \
+                            PULSE_BYTE(v, 3, WS2812A_PULSE3_ZERO, WS2812A_PULSE3_ONE, 0) }
+#define PULSE_ROW(entry, h)  entry((h) * 16 + 0), entry((h) * 16 + 1), entry((h) * 16 + 2), entry((h) * 16 + 3), \
+                             entry((h) * 16 + 4), entry((h) * 16 + 5), entry((h) * 16 + 6), entry((h) * 16 + 7), \
+                             entry((h) * 16 + 8), entry((h) * 16 + 9), entry((h) * 16 + 10), entry((h) * 16 + 11), \
+                             entry((h) * 16 + 12), entry((h) * 16 + 13), entry((h) * 16 + 14), entry((h) * 16 + 15)
+#define PULSE_TABLE(entry)   { PULSE_ROW(entry, 0), PULSE_ROW(entry, 1), PULSE_ROW(entry, 2), PULSE_ROW(entry, 3), \
+                               PULSE_ROW(entry, 4), PULSE_ROW(entry, 5), PULSE_ROW(entry, 6), PULSE_ROW(entry, 7), \
+                               PULSE_ROW(entry, 8), PULSE_ROW(entry, 9), PULSE_ROW(entry, 10), PULSE_ROW(entry, 11), \
+                               PULSE_ROW(entry, 12), PULSE_ROW(entry, 13), PULSE_ROW(entry, 14), PULSE_ROW(entry, 15) }
+
+/* SPI pulse patterns of all color byte values for every encoding; generated at compile time and placed in flash */
+static const uint8_t WS2812A_pulse_table5[256][5] = PULSE_TABLE(PULSE_ENTRY5);
+static const uint8_t WS2812A_pulse_table4[256][4] = PULSE_TABLE(PULSE_ENTRY4);
+static const uint8_t WS2812A_pulse_table3[256][3] = PULSE_TABLE(PULSE_ENTRY3);
+
+/* takes 8 bits and generates 8 5-bit pulses in the buffer */
+void bits_to_pulses(uint8_t color_value, uint8_t** ppBuffer)
+{
+  memcpy(*ppBuffer, WS2812A_pulse_table5[color_value], 5);
+  *ppBuffer += 5;
+}
+
+/* encodes the devices with the pulse table of byte_pulses bytes per color byte; inlined for every encoding;
+   the device colors are pRGB[pIndex[n]] if pIndex is not NULL */
+__STATIC_FORCEINLINE void WS2812A_encode_pulses(const RGB_t* pRGB, const uint8_t* pIndex, size_t numb_dev, const uint8_t* pScale,
+                                                WS2812A_ColorOrderTypeDef color_order, const uint8_t* pTable, const size_t byte_pulses, uint8_t* pBuffer)
+{
+  const uint8_t first_offset = WS2812A_color_offset[color_order][0];
+  const uint8_t middle_offset = WS2812A_color_offset[color_order][1];
+  const uint8_t last_offset = WS2812A_color_offset[color_order][2];
+
+  while(numb_dev--)
+  {
+    const uint8_t* pColor = (pIndex != NULL) ? (const uint8_t*)&pRGB[*pIndex++] : (const uint8_t*)pRGB++;
+    memcpy(pBuffer, &pTable[pScale[pColor[first_offset]] * byte_pulses], byte_pulses);
+    memcpy(pBuffer + byte_pulses, &pTable[pScale[pColor[middle_offset]] * byte_pulses], byte_pulses);
+    memcpy(pBuffer + 2 * byte_pulses, &pTable[pScale[pColor[last_offset]] * byte_pulses], byte_pulses);
+    pBuffer += 3 * byte_pulses;
+  }
+}
+
+/* selects the pulse table of the encoding; inlined for the RGB and the indexed devices */
+__STATIC_FORCEINLINE void WS2812A_encode_table(const RGB_t* pRGB, const uint8_t* pIndex, size_t numb_dev, const uint8_t* pScale,
+                                               WS2812A_ColorOrderTypeDef color_order, WS2812A_EncodingTypeDef encoding, uint8_t* pBuffer)
+{
+  switch(encoding)
+  {
+    case WS2812A_ENCODING_4BIT:
+    WS2812A_encode_pulses(pRGB, pIndex, numb_dev, pScale, color_order, &WS2812A_pulse_table4[0][0], 4, pBuffer);
+    break;
+
+    case WS2812A_ENCODING_3BIT:
+    WS2812A_encode_pulses(pRGB, pIndex, numb_dev, pScale, color_order, &WS2812A_pulse_table3[0][0], 3, pBuffer);
+    break;
+
+    default:
+    WS2812A_encode_pulses(pRGB, pIndex, numb_dev, pScale, color_order, &WS2812A_pulse_table5[0][0], 5, pBuffer);
+    break;
+  }
+}
+
+/* encodes an array of RGB devices scaled with the scale table into the pulse buffer in one pass */
+void WS2812A_encode(const RGB_t* pRGB, size_t numb_dev, const uint8_t* pScale, WS2812A_ColorOrderTypeDef color_order, WS2812A_EncodingTypeDef encoding, uint8_t* pBuffer)
+{
+  WS2812A_encode_table(pRGB, NULL, numb_dev, pScale, color_order, encoding, pBuffer);
+}
+
+#ifdef WS2812A_INDEXED_COLORS
+/* encodes an array of palette indexes of the devices scaled with the scale table into the pulse buffer in one pass */
+void WS2812A_encode_indexed(const uint8_t* pIndex, size_t numb_dev, const RGB_t* pPalette, const uint8_t* pScale, WS2812A_ColorOrderTypeDef color_order,
+                            WS2812A_EncodingTypeDef encoding, uint8_t* pBuffer)
+{
+  WS2812A_encode_table(pPalette, pIndex, numb_dev, pScale, color_order, encoding, pBuffer);
+}
+#endif
+
+/* returns the index of the device color in the ring of colors */
+static inline uint16_t WS2812A_ring_index(uint16_t dev_index)
+{
+  uint32_t index = (uint32_t)dev_index + ring_head;
+  return (index >= number_of_devices) ? (uint16_t)(index - number_of_devices) : (uint16_t)index;
+}
+
+/* returns the color at the index of the ring of colors */
+static inline const RGB_t* WS2812A_ring_color(uint16_t index)
+{
+#ifdef WS2812A_INDEXED_COLORS
+  return &device_palette[WS2812A_RGB_data[index]];
+#else
+  return &WS2812A_RGB_data[index];
+#endif
+}
+
+/* returns the color of the device */
+static inline RGB_t WS2812A_get_device(uint16_t dev_index)
+{
+  return *WS2812A_ring_color(WS2812A_ring_index(dev_index));
+}
+
+/* adds the device to the devices changed since the last transmission */
+static inline void WS2812A_mark_device(uint16_t dev_index)
+{
+  if(dev_index < dirty_first)
+  {
+    dirty_first = dev_index;
+  }
+  if(dev_index > dirty_last)
+  {
+    dirty_last = dev_index;
+  }
+}
+
+#ifdef WS2812A_INDEXED_COLORS
+/* the device takes the palette entry of its new color; the entry of the only device of its old color is changed in place */
+static inline void WS2812A_set_device(uint16_t dev_index, RGB_t color)
+{
+  uint8_t* pDevice = &WS2812A_RGB_data[WS2812A_ring_index(dev_index)];
+  RGB_t* pColor = &device_palette[*pDevice];
+
+  if((pColor->R != color.R) || (pColor->G != color.G) || (pColor->B != color.B))
+  {
+    uint8_t hash = WS2812A_color_hash(color);
+    uint8_t index = palette_hash[hash];
+    const RGB_t* pFound = &device_palette[index];
+    if((palette_users[index] != 0) && (pFound->R == color.R) && (pFound->G == color.G) && (pFound->B == color.B))
+    {
+      WS2812A_set_device_index(dev_index, index);
+    }
+    else if(palette_users[*pDevice] == 1)
+    {
+      *pColor = color;
+      palette_hash[hash] = *pDevice;
+      WS2812A_mark_device(dev_index);
+    }
+    else
+    {
+      WS2812A_set_device_index(dev_index, WS2812A_new_color(color));
+    }
+  }
+}
+#else
+/* sets the device color; the frame is marked for transmission only if the color changes */
+static inline void WS2812A_set_device(uint16_t dev_index, RGB_t color)
+{
+  RGB_t* pDevice = &WS2812A_RGB_data[WS2812A_ring_index(dev_index)];
+
+  if((pDevice->R != color.R) || (pDevice->G != color.G) || (pDevice->B != color.B))
+  {
+    *pDevice = color;
+    WS2812A_mark_device(dev_index);
+  }
+}
+#endif
+
+/* sets the color of consecutive devices */
+static void WS2812A_set_devices(uint16_t first_dev, uint16_t numb_dev, RGB_t color)
+{
+#ifdef WS2812A_INDEXED_COLORS
+  if((first_dev == 0) && (numb_dev == number_of_devices))
+  {
+    /* all devices get one palette entry; once they share it, only the entry changes */
+    uint8_t index = WS2812A_RGB_data[0];
+    if(palette_users[index] == number_of_devices)
+    {
+      WS2812A_set_palette(index, color);
+    }
+    else
+    {
+      WS2812A_reset_palette(index, color);
+    }
+    return;
+  }
+#endif
+  while(numb_dev--)
+  {
+    WS2812A_set_device(first_dev++, color);
+  }
+}
+
+/* moves the colors of all devices by one device toward the strip start by moving the ring head;
+   the last device gets the color of the first one and all devices must be re-encoded */
+static void WS2812A_scroll(void)
+{
+  ring_head = WS2812A_ring_index(1);
+  dirty_first = 0;
+  dirty_last = number_of_devices - 1;
+}
+
+/* encodes the strip devices <first,last> to the start of pBuffer; their colors may wrap around the end of the ring */
+static void WS2812A_encode_strip(const WS2812A_Strip_t* pStrip, uint16_t first, uint16_t last, uint8_t* pBuffer)
+{
+  uint16_t index = WS2812A_ring_index(pStrip->first_dev + first);
+  uint16_t numb_dev = last - first + 1;
+  uint16_t numb_to_end = number_of_devices - index;
+
+  if(numb_dev > numb_to_end)
+  {
+#ifdef WS2812A_INDEXED_COLORS
+    WS2812A_encode_indexed(&WS2812A_RGB_data[index], numb_to_end, device_palette, level_scale, pStrip->color_order, pStrip->encoding, pBuffer);
+#else
+    WS2812A_encode(&WS2812A_RGB_data[index], numb_to_end, level_scale, pStrip->color_order, pStrip->encoding, pBuffer);
+#endif
+    pBuffer += numb_to_end * pStrip->dev_size;
+    index = 0;
+    numb_dev -= numb_to_end;
+  }
+#ifdef WS2812A_INDEXED_COLORS
+  WS2812A_encode_indexed(&WS2812A_RGB_data[index], numb_dev, device_palette, level_scale, pStrip->color_order, pStrip->encoding, pBuffer);
+#else
+  WS2812A_encode(&WS2812A_RGB_data[index], numb_dev, level_scale, pStrip->color_order, pStrip->encoding, pBuffer);
+#endif
+}
+
+#ifdef WS2812A_INDEXED_COLORS
+/* returns the palette hash value of the color */
+static inline uint8_t WS2812A_color_hash(RGB_t color)
+{
+  return (uint8_t)(((((uint32_t)color.R << 16) | ((uint32_t)color.G << 8) | color.B) * 2654435761UL) >> 24);
+}
+
+/* returns a free palette entry set to the color; the nearest color in use if all entries are in use */
+static uint8_t WS2812A_new_color(RGB_t color)
+{
+  uint16_t count;
+  uint8_t index;
+
+  for(count = 0; count < WS2812A_NUMB_COLORS; count++)
+  {
+    index = palette_cursor++;
+    if(palette_users[index] == 0)
+    {
+      device_palette[index] = color;
+      palette_hash[WS2812A_color_hash(color)] = index;
+      return index;
+    }
+  }
+
+  uint32_t distance_min = UINT32_MAX;
+  uint16_t entry;
+  for(entry = 0; entry < WS2812A_NUMB_COLORS; entry++)
+  {
+    const RGB_t* pColor = &device_palette[entry];
+    uint32_t distance = (uint32_t)abs(pColor->R - color.R) + (uint32_t)abs(pColor->G - color.G) + (uint32_t)abs(pColor->B - color.B);
+    if(distance < distance_min)
+    {
+      distance_min = distance;
+      index = (uint8_t)entry;
+    }
+  }
+  WS2812A_stats.colors_merged++;
+  return index;
+}
+
+/* moves the device to the palette entry */
+static void WS2812A_set_device_index(uint16_t dev_index, uint8_t index)
+{
+  uint8_t* pDevice = &WS2812A_RGB_data[WS2812A_ring_index(dev_index)];
+
+  if(*pDevice != index)
+  {
+    palette_users[*pDevice]--;
+    palette_users[index]++;
+    *pDevice = index;
+    WS2812A_mark_device(dev_index);
+  }
+}
+
+/* changes the color of a palette entry; all devices are re-encoded if the entry is in use */
+static void WS2812A_set_palette(uint8_t index, RGB_t color)
+{
+  RGB_t* pColor = &device_palette[index];
+
+  if((pColor->R != color.R) || (pColor->G != color.G) || (pColor->B != color.B))
+  {
+    *pColor = color;
+    palette_hash[WS2812A_color_hash(color)] = index;
+    if(palette_users[index] != 0)
+    {
+      dirty_first = 0;
+      dirty_last = number_of_devices - 1;
+    }
+  }
+}
+
+/* moves all devices to the palette entry of the color; the other entries become free */
+static void WS2812A_reset_palette(uint8_t index, RGB_t color)
+{
+  uint16_t device;
+
+  for(device = 0; device < number_of_devices; device++)
+  {
+    const RGB_t* pColor = &device_palette[WS2812A_RGB_data[device]];
+    if((pColor->R != color.R) || (pColor->G != color.G) || (pColor->B != color.B))
+    {
+      dirty_first = 0;
+      dirty_last = number_of_devices - 1;
+      break;
+    }
+  }
+  memset(WS2812A_RGB_data, index, number_of_devices);
+  memset(palette_users, 0, sizeof(palette_users));
+  palette_users[index] = number_of_devices;
+  device_palette[index] = color;
+  palette_hash[WS2812A_color_hash(color)] = index;
+}
+#endif
+
+/* adds the devices changed in this frame (or all devices) to the ranges to be re-encoded in every pulse buffer */
+static void WS2812A_mark_buffers(bool all_devices)
+{
+  uint8_t strip;
+  uint8_t buffer_index;
+
+  for(strip = 0; strip < number_of_strips; strip++)
+  {
+    WS2812A_Strip_t* pStrip = &WS2812A_strips[strip];
+    uint16_t first, last;
+    if(all_devices)
+    {
+      first = 0;
+      last = pStrip->numb_dev - 1;
+    }
+    else
+    {
+      /* intersection of the changed devices with the strip */
+      if((dirty_first > dirty_last) ||
+         (dirty_last < pStrip->first_dev) ||
+         (dirty_first >= pStrip->first_dev + pStrip->numb_dev))
+      {
+        continue;
+      }
+      first = (dirty_first > pStrip->first_dev) ? dirty_first - pStrip->first_dev : 0;
+      last = (dirty_last < pStrip->first_dev + pStrip->numb_dev) ? dirty_last - pStrip->first_dev : pStrip->numb_dev - 1;
+    }
+#ifdef WS2812A_PARALLEL_OUTPUT
+    if(pStrip->pParallel != NULL)
+    {
+      /* the changed devices of one lane map to their rows; a change spanning lanes re-encodes all rows */
+      if(first / pStrip->numb_rows == last / pStrip->numb_rows)
+      {
+        first %= pStrip->numb_rows;
+        last %= pStrip->numb_rows;
+      }
+      else
+      {
+        first = 0;
+        last = pStrip->numb_rows - 1;
+      }
+    }
+#endif
+
+    for(buffer_index = 0; buffer_index < WS2812A_NUMB_PULSE_BUF; buffer_index++)
+    {
+      if(pStrip->dirty_first[buffer_index] > pStrip->dirty_last[buffer_index])
+      {
+        pStrip->dirty_first[buffer_index] = first;
+        pStrip->dirty_last[buffer_index] = last;
+      }
+      else
+      {
+        if(first < pStrip->dirty_first[buffer_index])
+        {
+          pStrip->dirty_first[buffer_index] = first;
+        }
+        if(last > pStrip->dirty_last[buffer_index])
+        {
+          pStrip->dirty_last[buffer_index] = last;
+        }
+      }
+    }
+  }
+}
+
+/* returns the perceptually corrected level for the Q8.8 light level; it is not 0 when the light level is at least 1 */
+static uint8_t WS2812A_correct_level(uint16_t level)
+{
+  uint32_t level_q4 = level >> 4;   /* level in Q8.4 format */
+  /* corrected = level * (level + 64) / 320 */
+  uint32_t corrected = level_q4 * (level_q4 + (64 << 4)) / (320 << 8);
+
+  if((level >= (1 << 8)) && (corrected < 0xFF))
+  {
+    ++corrected;
+  }
+
+  return (uint8_t)corrected;
+}
+
+/* rebuilds the table of color values scaled by the corrected level */
+static void WS2812A_build_scale(uint8_t level)
+{
+  uint32_t product = 0;     /* color value * level */
+  uint16_t value;
+
+  for(value = 0; value < 256; value++)
+  {
+    level_scale[value] = (uint8_t)(product / 0xFF);
+    product += level;
+  }
+  level_corrected = level;
+}
+
+void WS2812A_handler(void)
+{
+  bool transmit_request = false;
+
+  /* streamed strips read the colors during their transmission; the frame runs after its end */
+  UTILS_ENTER_CRITICAL_SECTION();
+  frame_postponed = (streams_busy != 0);
+  UTILS_EXIT_CRITICAL_SECTION();
+  if(frame_postponed)
+  {
+    return;
+  }
+
+  uint32_t tick = HAL_GetTick();
+  frame_elapsed = tick - frame_tick;
+  frame_tick = tick;
+
+  /* the commands change the light parameters only here */
+  WS2812A_apply_commands();
+
+  /* check if global color must be set */
+  if(light_params.set_color_XY | light_params.set_color_HS | light_params.set_color_temp | light_params.color_restore)
+  {
+    /* set a global color */
+
+    /* a new global color supersedes the transition in progress */
+    WS2812A_stop_color_transition();
+
+    if(light_params.set_color_XY)
+    {
+      if(light_params.color_transition_time >= frame_interval_min)
+      {
+        /* move to the color in steps from the current color */
+        WS2812A_start_color_transition(light_params.color_xy, light_params.color_transition_time);
+      }
+      else
+      {
+        /* set a global color from XY space */
+        color_xy_current = light_params.color_xy;
+        color_xy_valid = true;
+        light_params.color_rgb = convert_XY_to_RGB(color_xy_current);
+      }
+      WS2812A_stop_hue_sat();
+      ANIM_Stop(ANIM_MIREDS);
+      color_hs_valid = false;
+      color_temp_valid = false;
+      /* mark as done */
+      light_params.set_color_XY = false;          
+    }
+    else if(light_params.set_color_HS)
+    {
+      /* set a global color from HS space; the hue and saturation have been set by the hue_sat functions */
+      RGB_t target_rgb = convert_HSV_to_RGB(ANIM_Target(ANIM_HUE) >> 16, (uint8_t)(ANIM_Target(ANIM_SAT) >> 16));
+      if(!color_hs_valid && (hs_fade_time >= frame_interval_min))
+      {
+        /* the current color is unknown in HS space - fade in RGB space */
+        WS2812A_start_rgb_transition(target_rgb, hs_fade_time);
+      }
+      else if(!WS2812A_hs_active())
+      {
+        light_params.color_rgb = target_rgb;
+      }
+      hs_fade_time = 0;
+      hs_settled = false;
+      color_hs_valid = true;
+      color_xy_valid = false;
+      ANIM_Stop(ANIM_MIREDS);
+      color_temp_valid = false;
+      /* mark as done */
+      light_params.set_color_HS = false;        
+    }
+    else if(light_params.set_color_temp)
+    {
+      /* set a global color from the color temperature table; a move or step has been set by the color_temp functions */
+      if(!ANIM_Active(ANIM_MIREDS))
+      {
+        ANIM_Set(ANIM_MIREDS, (uint32_t)light_params.color_temp << 16);
+      }
+      uint16_t target_temp = ANIM_Target(ANIM_MIREDS) >> 16;
+      RGB_t target_rgb = convert_temp_to_RGB(target_temp);
+      if(!color_temp_valid && (temp_fade_time >= frame_interval_min))
+      {
+        /* fade in RGB space from a color other than a color temperature */
+        WS2812A_start_rgb_transition(target_rgb, temp_fade_time);
+      }
+      else if(!ANIM_Active(ANIM_MIREDS))
+      {
+        light_params.color_rgb = target_rgb;
+      }
+      temp_fade_time = 0;
+      temp_settled = false;
+      color_temp_valid = true;
+      /* the XY color is the start point of a subsequent XY transition */
+      color_xy_current = convert_temp_to_XY(target_temp);
+      color_xy_valid = true;
+      WS2812A_stop_hue_sat();
+      color_hs_valid = false;
+      /* mark as done */
+      light_params.set_color_temp = false;        
+    }
+    else if(light_params.color_restore)
+    {
+      WS2812A_stop_hue_sat();
+      ANIM_Stop(ANIM_MIREDS);
+      light_params.color_restore = false;
+      /* do nothing else - just restore static RGB color */
+    }
+
+    WS2812A_set_devices(0, number_of_devices, light_params.color_rgb);
+
+    /* global color sets color mode to static; the color loop starts anew when it is turned on again */
+    light_params.color_mode = COLOR_STATIC;
+    ANIM_Stop(ANIM_EFFECT);
+    effect_running = WS2812A_NO_EFFECT;
+  }
+
+  /* a new level target or transition time set by the application starts the level transition from the current level */
+  if((light_params.level_target != level_started) || (light_params.transition_time != level_remaining))
+  {
+    ANIM_Start(ANIM_LEVEL, (int64_t)light_params.level_target * ANIM_ONE - ANIM_Value(ANIM_LEVEL), light_params.transition_time, frame_tick);
+    level_started = light_params.level_target;
+  }
+
+  /* all animated parameters are advanced to the time of this frame */
+  uint32_t animated = ANIM_Update(frame_tick);
+  level_current = (uint16_t)(ANIM_Value(ANIM_LEVEL) >> 8);
+  level_remaining = ANIM_Remaining(ANIM_LEVEL, frame_tick);
+  light_params.transition_time = level_remaining;
+
+  /* the global color transition; a color loop takes over the devices */
+  if(color_transition.active)
+  {
+    if(light_params.color_mode == COLOR_STATIC)
+    {
+      WS2812A_step_color_transition();
+    }
+    else
+    {
+      WS2812A_stop_color_transition();
+    }
+  }
+
+  /* the hue and saturation moves */
+  if((animated & (ANIM_MASK(ANIM_HUE) | ANIM_MASK(ANIM_SAT))) != 0)
+  {
+    if(light_params.color_mode == COLOR_STATIC)
+    {
+      WS2812A_step_hue_sat();
+    }
+    else
+    {
+      WS2812A_stop_hue_sat();
+    }
+  }
+  if(!hs_settled && !WS2812A_hs_active())
+  {
+    /* the final hue and saturation are reported once */
+    hs_settled = true;
+    WS2812A_HueSatCallback(ANIM_Value(ANIM_HUE) >> 16, (uint8_t)(ANIM_Value(ANIM_SAT) >> 16));
+  }
+
+  /* the color temperature move */
+  if((animated & ANIM_MASK(ANIM_MIREDS)) != 0)
+  {
+    if(light_params.color_mode == COLOR_STATIC)
+    {
+      WS2812A_step_temp();
+    }
+    else
+    {
+      ANIM_Stop(ANIM_MIREDS);
+    }
+  }
+  if(!temp_settled && !ANIM_Active(ANIM_MIREDS))
+  {
+    /* the final color temperature is reported once */
+    temp_settled = true;
+    light_params.color_temp = (ANIM_Value(ANIM_MIREDS) + 0x8000) >> 16;
+    color_xy_current = convert_temp_to_XY(light_params.color_temp);
+    WS2812A_ColorTempCallback(light_params.color_temp);
+  }
+  WS2812A_report_remaining_time();
+
+  /* check if color mode loop is active */
+  if(light_params.color_mode == COLOR_LOOP)
+  {
+    const WS2812A_Effect_t* pEffect;
+    if(light_params.effect != effect_running)
+    {
+      /* a new effect starts with its default parameters and a zeroed state */
+      if(light_params.effect >= WS2812A_GetNumbEffects())
+      {
+        light_params.effect = 0;
+      }
+      effect_running = light_params.effect;
+      pEffect = WS2812A_get_effect(effect_running);
+      light_params.effect_params = pEffect->params;
+      light_params.set_effect_params = false;
+      memset(effect_arena, 0, sizeof(effect_arena));
+      if((effect_running < WS2812A_NUMB_EFFECTS) && (effect_streams[effect_running].inc == 0))
+      {
+        PRNG_Seed(&effect_streams[effect_running], effect_running);
+      }
+      random_used = WS2812A_RANDOM_BUF_SIZE;
+      pEffect->init(effect_arena, &light_params.effect_params);
+    }
+    else
+    {
+      pEffect = WS2812A_get_effect(effect_running);
+      if(light_params.set_effect_params)
+      {
+        light_params.set_effect_params = false;
+        if(pEffect->param != NULL)
+        {
+          pEffect->param(effect_arena, &light_params.effect_params);
+        }
+      }
+    }
+    pEffect->render(effect_arena, &light_params.effect_params);
+  }
+
+  /* the scale table is rebuilt only when the corrected level changes */
+  uint8_t level_new = WS2812A_correct_level(level_current);
+  if(level_new != level_corrected)
+  {
+    WS2812A_build_scale(level_new);
+    /* all devices must be re-encoded with the new level */
+    WS2812A_mark_buffers(true);
+    /* transmit only if the corrected level has been effectively changed */
+    transmit_request = true;
+  }
+
+  /* apply changes of the devices by transmission; an unchanged frame is retransmitted periodically for glitch recovery */
+  if(dirty_first <= dirty_last)
+  {
+    WS2812A_mark_buffers(false);
+    transmit_request = true;
+  }
+#if WS2812A_REFRESH_INTERVAL > 0
+  /* the refresh frame of the clock may come a little earlier than the interval after the last transmission */
+  if(HAL_GetTick() - last_transmit_tick + WS2812A_FRAME_INTERVAL_MIN >= WS2812A_REFRESH_INTERVAL)
+  {
+    transmit_request = true;
+  }
+#endif
+
+  /* the latency of a requested frame is measured until the DMA start; a frame without changes ends the measurement */
+  if(frame_requested)
+  {
+    frame_requested = false;
+    if(transmit_request)
+    {
+      latency_stamp = request_stamp;
+      latency_pending = true;
+    }
+  }
+
+  /* transmit pulses to WS2812A devices */
+  if(transmit_request)
+  {
+    dirty_first = UINT16_MAX;
+    dirty_last = 0;
+    last_transmit_tick = HAL_GetTick();
+
+    /* strip DMA transfers run while the next strips are being encoded */
+    uint8_t strip;
+    for(strip = 0; strip < number_of_strips; strip++)
+    {
+      WS2812A_Strip_t* pStrip = &WS2812A_strips[strip];
+      if(pStrip->streaming)
+      {
+        /* the pulses of all devices are encoded during the transmission */
+        WS2812A_transmit(pStrip, 0);
+        continue;
+      }
+
+      /* generate WS2812A pulses of the devices changed since the last use of the buffer not used by DMA */
+      uint8_t buffer_index = WS2812A_acquire_buffer(pStrip);
+      uint16_t first = pStrip->dirty_first[buffer_index];
+      uint16_t last = pStrip->dirty_last[buffer_index];
+      if(first <= last)
+      {
+#ifdef WS2812A_PARALLEL_OUTPUT
+        if(pStrip->pParallel != NULL)
+        {
+          WS2812A_encode_lanes(pStrip, first, last, pStrip->pPulseBuffer[buffer_index] + first * pStrip->dev_size);
+        }
+        else
+#endif
+        {
+          WS2812A_encode_strip(pStrip, first, last, pStrip->pPulseBuffer[buffer_index] + first * pStrip->dev_size);
+        }
+        pStrip->dirty_first[buffer_index] = UINT16_MAX;
+        pStrip->dirty_last[buffer_index] = 0;
+      }
+
+      /* transmit data to all WS2812A devices of the strip */
+      WS2812A_transmit(pStrip, buffer_index);
+    }
+  }
+
+  /* the frame clock follows the changes in progress; a static strip needs only the refresh frames */
+  uint32_t interval = WS2812A_needed_interval();
+#if WS2812A_REFRESH_INTERVAL > 0
+  if(interval == 0)
+  {
+    interval = WS2812A_REFRESH_INTERVAL;
+  }
+#endif
+  WS2812A_set_frame_interval(interval);
+}
+
+/* returns the kernel clock of the SPI [Hz] */
+static uint32_t WS2812A_spi_clock(const SPI_HandleTypeDef* phSPI)
+{
+  /* SPI1 is clocked from APB2, the other SPIs from APB1 */
+  return (phSPI->Instance == SPI1) ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq();
+}
+
+/* returns the SPI prescaler giving the pulses of the encoding within the device timing tolerances
+   with the bit period closest to the nominal one; UINT32_MAX if no prescaler fits */
+static uint32_t WS2812A_select_prescaler(uint32_t spi_clock, const WS2812A_Encoding_t* pEncoding)
+{
+  uint32_t prescaler = UINT32_MAX;
+  uint32_t best_error = UINT32_MAX;
+  uint32_t br;
+
+  for(br = 0; br <= (SPI_CR1_BR >> SPI_CR1_BR_Pos); br++)
+  {
+    /* the SPI clock is divided by 2^(br+1) */
+    uint32_t spi_bit_time = (uint32_t)((2000000000ULL << br) / spi_clock);    /* [ns] */
+    uint32_t t0h = pEncoding->t0h_bits * spi_bit_time;
+    uint32_t t1h = pEncoding->t1h_bits * spi_bit_time;
+    uint32_t t_bit = pEncoding->bits * spi_bit_time;
+    if((t0h < WS2812A_T0H_MIN) || (t0h > WS2812A_T0H_MAX) ||
+       (t1h < WS2812A_T1H_MIN) || (t1h > WS2812A_T1H_MAX) ||
+       (t_bit < WS2812A_TBIT_MIN) || (t_bit > WS2812A_TBIT_MAX))
+    {
+      continue;
+    }
+    uint32_t error = (t_bit > WS2812A_TBIT) ? t_bit - WS2812A_TBIT : WS2812A_TBIT - t_bit;
+    if(error < best_error)
+    {
+      best_error = error;
+      prescaler = br << SPI_CR1_BR_Pos;
+    }
+  }
+
+  return prescaler;
+}
+
+/* checks the DMA mode of an SPI strip and selects the SPI prescaler of its encoding */
+static bool WS2812A_config_spi(WS2812A_Strip_t* pStrip, uint32_t* pPrescaler)
+{
+  if(pStrip->phSPI == NULL)
+  {
+    return false;
+  }
+  /* a streamed strip wraps around its pulse ring; a buffered one stops at the end of its buffer */
+  const DMA_HandleTypeDef* phDMA = pStrip->phSPI->hdmatx;
+  if((phDMA == NULL) || ((phDMA->Init.Mode == DMA_CIRCULAR) != pStrip->streaming))
+  {
+    return false;
+  }
+
+  const WS2812A_Encoding_t* pEncoding = &WS2812A_encodings[pStrip->encoding];
+  uint32_t spi_clock = WS2812A_spi_clock(pStrip->phSPI);
+  *pPrescaler = WS2812A_select_prescaler(spi_clock, pEncoding);
+  if(*pPrescaler == UINT32_MAX)
+  {
+    return false;
+  }
+
+  pStrip->dev_size = 3 * pEncoding->bits;
+  /* the SPI clock is divided by 2^(br+1); 8 bits per byte */
+  pStrip->byte_rate = spi_clock >> ((*pPrescaler >> SPI_CR1_BR_Pos) + 4);
+  return true;
+}
+
+#ifdef WS2812A_PARALLEL_OUTPUT
+#define WS2812A_SLOTS  3    /* timer slots per device bit of a parallel output: all lanes high, data bits, all lanes low */
+
+/* returns the kernel clock of the timer [Hz]; it is twice the APB clock if the APB clock is divided */
+static uint32_t WS2812A_timer_clock(const TIM_HandleTypeDef* phTIM)
+{
+  RCC_ClkInitTypeDef clock_config;
+  uint32_t flash_latency;
+
+  HAL_RCC_GetClockConfig(&clock_config, &flash_latency);
+  /* TIM1, TIM16 and TIM17 are clocked from APB2, TIM2 from APB1 */
+  bool apb2 = (phTIM->Instance == TIM1) || (phTIM->Instance == TIM16) || (phTIM->Instance == TIM17);
+  uint32_t pclk = apb2 ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq();
+  uint32_t apb_divider = apb2 ? clock_config.APB2CLKDivider : clock_config.APB1CLKDivider;
+  return (apb_divider == RCC_HCLK_DIV1) ? pclk : 2 * pclk;
+}
+
+/* checks the lanes and the DMA mode of a parallel output and selects the timer period of a slot */
+static bool WS2812A_config_parallel(WS2812A_Strip_t* pStrip, uint32_t* pPeriod)
+{
+  const WS2812A_ParallelConfig_t* pParallel = pStrip->pParallel;
+  if((pParallel->phTIM == NULL) || (pParallel->pPort == NULL) ||
+     (pParallel->numb_lanes == 0) || (pParallel->numb_lanes > WS2812A_MAX_LANES) || pStrip->streaming ||
+     ((uint32_t)pStrip->numb_dev * pParallel->numb_lanes > UINT16_MAX))
+  {
+    return false;
+  }
+  const DMA_HandleTypeDef* phDMA = pParallel->phTIM->hdma[TIM_DMA_ID_UPDATE];
+  if((phDMA == NULL) || (phDMA->Init.Mode != DMA_NORMAL))
+  {
+    return false;
+  }
+
+  /* a slot is a third of the nominal bit period; bit 0 is high for 1 slot and bit 1 for 2 slots */
+  uint32_t timer_clock = WS2812A_timer_clock(pParallel->phTIM);
+  uint32_t period = (uint32_t)(((uint64_t)timer_clock * WS2812A_TBIT + WS2812A_SLOTS * 500000000ULL) / (WS2812A_SLOTS * 1000000000ULL));
+  if((period == 0) || (period > 0x10000))
+  {
+    return false;
+  }
+  uint32_t slot_time = (uint32_t)(period * 1000000000ULL / timer_clock);  /* [ns] */
+  if((slot_time < WS2812A_T0H_MIN) || (slot_time > WS2812A_T0H_MAX) ||
+     (2 * slot_time < WS2812A_T1H_MIN) || (2 * slot_time > WS2812A_T1H_MAX) ||
+     (WS2812A_SLOTS * slot_time < WS2812A_TBIT_MIN) || (WS2812A_SLOTS * slot_time > WS2812A_TBIT_MAX))
+  {
+    return false;
+  }
+
+  *pPeriod = period;
+  pStrip->phSPI = NULL;
+  pStrip->numb_rows = pStrip->numb_dev;
+  pStrip->numb_dev = pStrip->numb_dev * pParallel->numb_lanes;
+  pStrip->dev_size = 3 * 8 * WS2812A_SLOTS;
+  pStrip->byte_rate = timer_clock / period;
+  return true;
+}
+
+/* sets the timer of a parallel output to the slot period and links the DMA callbacks */
+static void WS2812A_setup_parallel(WS2812A_Strip_t* pStrip, uint32_t period)
+{
+  TIM_HandleTypeDef* phTIM = pStrip->pParallel->phTIM;
+  DMA_HandleTypeDef* phDMA = phTIM->hdma[TIM_DMA_ID_UPDATE];
+
+  __HAL_TIM_DISABLE(phTIM);
+  phTIM->Init.Prescaler = 0;
+  phTIM->Init.Period = period - 1;
+  __HAL_TIM_SET_PRESCALER(phTIM, phTIM->Init.Prescaler);
+  __HAL_TIM_SET_AUTORELOAD(phTIM, phTIM->Init.Period);
+  phDMA->XferCpltCallback = WS2812A_parallel_complete;
+  phDMA->XferHalfCpltCallback = NULL;
+  phDMA->XferErrorCallback = WS2812A_parallel_error;
+}
+
+/* fills the constant slots of a pulse buffer of a parallel output: the lanes go high at the start of every bit and low at its end */
+static void WS2812A_prepare_slots(const WS2812A_Strip_t* pStrip, uint8_t* pBuffer)
+{
+  uint8_t lane_mask = (uint8_t)((1U << pStrip->pParallel->numb_lanes) - 1);
+  uint32_t slot;
+
+  memset(pBuffer, 0, WS2812A_PULSE_BUF_SIZE(pStrip));
+  for(slot = 0; slot < (uint32_t)pStrip->numb_rows * pStrip->dev_size; slot += WS2812A_SLOTS)
+  {
+    pBuffer[slot] = lane_mask;
+  }
+}
+
+/* transposes the 8x8 bit matrix of a color component of 8 lanes; bit plane n (MSB first) gets the bit of lane k in its bit k;
+   the planes are written every WS2812A_SLOTS bytes */
+static inline void WS2812A_transpose8(const uint8_t* pLane, uint8_t* pPlane)
+{
+  uint32_t x = ((uint32_t)pLane[7] << 24) | ((uint32_t)pLane[6] << 16) | ((uint32_t)pLane[5] << 8) | pLane[4];
+  uint32_t y = ((uint32_t)pLane[3] << 24) | ((uint32_t)pLane[2] << 16) | ((uint32_t)pLane[1] << 8) | pLane[0];
+  uint32_t t;
+
+  /* swaps of 1-bit, 2-bit and 4-bit blocks */
+  t = (x ^ (x >> 7)) & 0x00AA00AA;
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;
+  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC;
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC;
+  y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+
+  pPlane[0 * WS2812A_SLOTS] = (uint8_t)(x >> 24);
+  pPlane[1 * WS2812A_SLOTS] = (uint8_t)(x >> 16);
+  pPlane[2 * WS2812A_SLOTS] = (uint8_t)(x >> 8);
+  pPlane[3 * WS2812A_SLOTS] = (uint8_t)x;
+  pPlane[4 * WS2812A_SLOTS] = (uint8_t)(y >> 24);
+  pPlane[5 * WS2812A_SLOTS] = (uint8_t)(y >> 16);
+  pPlane[6 * WS2812A_SLOTS] = (uint8_t)(y >> 8);
+  pPlane[7 * WS2812A_SLOTS] = (uint8_t)y;
+}
+
+/* encodes the rows <first,last> of a parallel output to the start of pBuffer; a row holds the devices of the same index in all lanes */
+static void WS2812A_encode_lanes(const WS2812A_Strip_t* pStrip, uint16_t first, uint16_t last, uint8_t* pBuffer)
+{
+  const uint8_t* pOffset = WS2812A_color_offset[pStrip->color_order];
+  uint8_t lane_values[3][WS2812A_MAX_LANES] = { { 0 } };   /* scaled color components of the lanes in the order of transmission */
+  uint16_t row;
+  uint8_t lane;
+  uint8_t component;
+
+  for(row = first; row <= last; row++)
+  {
+    for(lane = 0; lane < pStrip->pParallel->numb_lanes; lane++)
+    {
+      const uint8_t* pColor = (const uint8_t*)WS2812A_ring_color(WS2812A_ring_index(pStrip->first_dev + lane * pStrip->numb_rows + row));
+      for(component = 0; component < 3; component++)
+      {
+        lane_values[component][lane] = level_scale[pColor[pOffset[component]]];
+      }
+    }
+    for(component = 0; component < 3; component++)
+    {
+      /* the data slots of the 8 bits of the component */
+      WS2812A_transpose8(lane_values[component], pBuffer + 1 + component * 8 * WS2812A_SLOTS);
+    }
+    pBuffer += pStrip->dev_size;
+  }
+}
+
+/* stops the timer of a parallel output; the lanes stay low after the last slot */
+static void WS2812A_stop_parallel(WS2812A_Strip_t* pStrip)
+{
+  TIM_HandleTypeDef* phTIM = pStrip->pParallel->phTIM;
+
+  __HAL_TIM_DISABLE_DMA(phTIM, TIM_DMA_UPDATE);
+  __HAL_TIM_DISABLE(phTIM);
+}
+
+/* returns the parallel output written by the DMA channel or NULL if the channel does not belong to the driver */
+static WS2812A_Strip_t* WS2812A_find_parallel(DMA_HandleTypeDef* phDMA)
+{
+  uint8_t strip;
+
+  for(strip = 0; strip < number_of_strips; strip++)
+  {
+    if((WS2812A_strips[strip].pParallel != NULL) && (WS2812A_strips[strip].pParallel->phTIM->hdma[TIM_DMA_ID_UPDATE] == phDMA))
+    {
+      return &WS2812A_strips[strip];
+    }
+  }
+
+  return NULL;
+}
+
+/* DMA has written the whole buffer of a parallel output including the latch */
+static void WS2812A_parallel_complete(DMA_HandleTypeDef* phDMA)
+{
+  WS2812A_Strip_t* pStrip = WS2812A_find_parallel(phDMA);
+  if(pStrip == NULL)
+  {
+    return;
+  }
+
+  WS2812A_stop_parallel(pStrip);
+  WS2812A_tx_complete(pStrip);
+}
+
+/* DMA transfer error of a parallel output; the frame is lost */
+static void WS2812A_parallel_error(DMA_HandleTypeDef* phDMA)
+{
+  WS2812A_Strip_t* pStrip = WS2812A_find_parallel(phDMA);
+  if(pStrip == NULL)
+  {
+    return;
+  }
+
+  WS2812A_stop_parallel(pStrip);
+  pStrip->tx_busy = false;
+  WS2812A_stats.frames_dropped++;
+}
+#endif
+
+/* frame clock tick; called from the timer server interrupt */
+static void WS2812A_frame_clock(void)
+{
+  UTIL_SEQ_SetTask(WS2812A_TASK, 1);
+}
+
+/* restarts the frame clock if its interval changes; 0 stops the clock */
+static void WS2812A_set_frame_interval(uint32_t interval)
+{
+  if(!frame_clock_created || (interval == frame_interval))
+  {
+    return;
+  }
+  frame_interval = interval;
+  if(interval == 0)
+  {
+    HW_TS_Stop(frame_timer_id);
+  }
+  else
+  {
+    HW_TS_Start(frame_timer_id, WS2812A_TS_TICKS(interval));
+  }
+}
+
+/* returns the frame interval showing every visible change of the running transitions and effect [ms]; 0 if nothing changes */
+static uint32_t WS2812A_needed_interval(void)
+{
+  /* the smallest visible change of the animated light parameters; the effect channel is interpreted by the effect */
+  static const uint32_t visible_step[ANIM_EFFECT] =
+  {
+    [ANIM_LEVEL] = ANIM_ONE,
+    [ANIM_HUE] = 0x100 * ANIM_ONE,
+    [ANIM_SAT] = ANIM_ONE,
+    [ANIM_X] = 0x40 * ANIM_ONE,
+    [ANIM_Y] = 0x40 * ANIM_ONE,
+    [ANIM_MIREDS] = ANIM_ONE,
+    [ANIM_RED] = ANIM_ONE,
+    [ANIM_GREEN] = ANIM_ONE,
+    [ANIM_BLUE] = ANIM_ONE
+  };
+  uint32_t step_time = UINT32_MAX;
+  uint8_t channel;
+
+  for(channel = 0; channel < ANIM_EFFECT; channel++)
+  {
+    uint32_t channel_time = ANIM_StepTime((ANIM_ChannelTypeDef)channel, visible_step[channel]);
+    if(channel_time < step_time)
+    {
+      step_time = channel_time;
+    }
+  }
+
+  /* an effect of a dark strip is not visible; it continues from the elapsed time when the light turns on */
+  if((effect_running != WS2812A_NO_EFFECT) && ((level_current != 0) || ANIM_Active(ANIM_LEVEL)))
+  {
+    uint32_t effect_time = WS2812A_get_effect(effect_running)->step_time(effect_arena, &light_params.effect_params);
+    if(effect_time < step_time)
+    {
+      step_time = effect_time;
+    }
+  }
+
+  if(step_time == UINT32_MAX)
+  {
+    return 0;
+  }
+  if(step_time > WS2812A_FRAME_INTERVAL_MAX)
+  {
+    step_time = WS2812A_FRAME_INTERVAL_MAX;
+  }
+  return (step_time < frame_interval_min) ? frame_interval_min : step_time;
+}
+
+/* applies the commands posted since the previous frame in their order */
+static void WS2812A_apply_commands(void)
+{
+  uint32_t tail = queue_tail;
+  uint32_t head = queue_head;
+
+  /* the commands are read after their publication */
+  WS2812A_BARRIER();
+  for(; tail != head; tail++)
+  {
+    const WS2812A_Command_t* pCommand = &command_queue[tail % WS2812A_QUEUE_SIZE];
+    if((tail + 1 != head) && WS2812A_supersedes(&command_queue[(tail + 1) % WS2812A_QUEUE_SIZE], pCommand))
+    {
+      /* e.g. the intermediate positions of a slider */
+      WS2812A_stats.commands_collapsed++;
+      continue;
+    }
+    WS2812A_execute(pCommand);
+  }
+  /* the commands are read before their slots are released */
+  WS2812A_BARRIER();
+  queue_tail = tail;
+}
+
+/* returns true if the newer command sets everything the older one does, so the older one can be skipped */
+static bool WS2812A_supersedes(const WS2812A_Command_t* pNewer, const WS2812A_Command_t* pOlder)
+{
+  switch(pOlder->type)
+  {
+    case WS2812A_CMD_ON:
+    case WS2812A_CMD_OFF:
+    return (pNewer->type == WS2812A_CMD_ON) || (pNewer->type == WS2812A_CMD_OFF);
+
+    case WS2812A_CMD_LEVEL_MOVE_TO:
+    return (pNewer->type == WS2812A_CMD_LEVEL_MOVE_TO) && (pNewer->level_move_to.with_onoff == pOlder->level_move_to.with_onoff);
+
+    case WS2812A_CMD_HUE_SAT_MOVE_TO:
+    return (pNewer->type == WS2812A_CMD_HUE_SAT_MOVE_TO) &&
+           ((pNewer->hue_sat_move_to.components & pOlder->hue_sat_move_to.components) == pOlder->hue_sat_move_to.components);
+
+    case WS2812A_CMD_HUE_SAT_MOVE:
+    return (pNewer->type == WS2812A_CMD_HUE_SAT_MOVE) && (pNewer->hue_sat_move.components == pOlder->hue_sat_move.components);
+
+    case WS2812A_CMD_LEVEL_MOVE:
+    case WS2812A_CMD_COLOR_XY:
+    case WS2812A_CMD_TEMP_MOVE_TO:
+    case WS2812A_CMD_TEMP_MOVE:
+    case WS2812A_CMD_COLOR_STOP:
+    case WS2812A_CMD_LOOP_STOP:
+    return pNewer->type == pOlder->type;
+
+    default:
+    /* steps and effect selection are relative to the current state */
+    return false;
+  }
+}
+
+/* changes the light parameters by the command */
+static void WS2812A_execute(const WS2812A_Command_t* pCommand)
+{
+  switch(pCommand->type)
+  {
+    case WS2812A_CMD_ON:
+    light_params.level_target = light_params.level_on;
+    break;
+
+    case WS2812A_CMD_OFF:
+    light_params.level_target = 0;
+    break;
+
+    case WS2812A_CMD_LEVEL_MOVE_TO:
+    light_params.level_on = pCommand->level_move_to.level;
+    if(pCommand->level_move_to.with_onoff)
+    {
+      light_params.level_target = light_params.level_on;
+      light_params.transition_time = pCommand->level_move_to.transition_time;
+    }
+    break;
+
+    case WS2812A_CMD_LEVEL_MOVE:
+    WS2812A_brightness_move(pCommand->level_move.mode, pCommand->level_move.rate);
+    break;
+
+    case WS2812A_CMD_LEVEL_STEP:
+    WS2812A_level_step(pCommand->level_step.mode, pCommand->level_step.size, pCommand->level_step.transition_time);
+    break;
+
+    case WS2812A_CMD_COLOR_XY:
+    light_params.color_xy = pCommand->color_xy.color_xy;
+    light_params.color_transition_time = pCommand->color_xy.transition_time;
+    light_params.set_color_XY = true;
+    break;
+
+    case WS2812A_CMD_HUE_SAT_MOVE_TO:
+    WS2812A_hue_sat_move_to(pCommand->hue_sat_move_to.components, pCommand->hue_sat_move_to.enh_hue, pCommand->hue_sat_move_to.sat,
+                            pCommand->hue_sat_move_to.direction, pCommand->hue_sat_move_to.transition_time);
+    break;
+
+    case WS2812A_CMD_HUE_SAT_MOVE:
+    WS2812A_hue_sat_move(pCommand->hue_sat_move.components, pCommand->hue_sat_move.rate);
+    break;
+
+    case WS2812A_CMD_HUE_SAT_STEP:
+    WS2812A_hue_sat_step(pCommand->hue_sat_step.components, pCommand->hue_sat_step.step, pCommand->hue_sat_step.transition_time);
+    break;
+
+    case WS2812A_CMD_TEMP_MOVE_TO:
+    WS2812A_color_temp_move_to(pCommand->temp_move_to.color_temp, pCommand->temp_move_to.transition_time);
+    break;
+
+    case WS2812A_CMD_TEMP_MOVE:
+    WS2812A_color_temp_move(pCommand->temp_move.rate, pCommand->temp_move.temp_min, pCommand->temp_move.temp_max);
+    break;
+
+    case WS2812A_CMD_TEMP_STEP:
+    WS2812A_color_temp_step(pCommand->temp_step.step, pCommand->temp_step.transition_time, pCommand->temp_step.temp_min,
+                            pCommand->temp_step.temp_max);
+    break;
+
+    case WS2812A_CMD_COLOR_STOP:
+    WS2812A_color_move_stop();
+    break;
+
+    case WS2812A_CMD_LOOP_START:
+    WS2812A_loop_start(pCommand->loop_start.effect_step, pCommand->loop_start.effect, pCommand->loop_start.direction);
+    break;
+
+    case WS2812A_CMD_LOOP_STOP:
+    light_params.color_restore = true;
+    break;
+
+    default:
+    break;
+  }
+}
+
+/* returns the index of the pulse buffer free for encoding; a frame still waiting for transmission in it is dropped */
+static uint8_t WS2812A_acquire_buffer(WS2812A_Strip_t* pStrip)
+{
+  uint8_t buffer_index;
+
+  UTILS_ENTER_CRITICAL_SECTION();
+  if(pStrip->tx_pending)
+  {
+    /* the waiting frame is superseded by the new one */
+    pStrip->tx_pending = false;
+    WS2812A_stats.frames_dropped++;
+  }
+  buffer_index = (pStrip->tx_buffer_index + 1) % WS2812A_NUMB_PULSE_BUF;
+  UTILS_EXIT_CRITICAL_SECTION();
+
+  return buffer_index;
+}
+
+/* hands over the encoded buffer to SPI DMA; the frame is deferred if DMA is still streaming the previous one */
+static void WS2812A_transmit(WS2812A_Strip_t* pStrip, uint8_t buffer_index)
+{
+  UTILS_ENTER_CRITICAL_SECTION();
+  if(pStrip->tx_busy)
+  {
+    /* the buffer is passed to DMA in the transmission complete callback */
+    pStrip->tx_pending = true;
+    WS2812A_stats.frames_deferred++;
+  }
+  else
+  {
+    WS2812A_start_DMA(pStrip, buffer_index);
+  }
+  UTILS_EXIT_CRITICAL_SECTION();
+}
+
+/* starts DMA transmission of the pulse buffer; must be called with interrupts disabled or from SPI interrupt */
+static void WS2812A_start_DMA(WS2812A_Strip_t* pStrip, uint8_t buffer_index)
+{
+  uint8_t* pData = pStrip->pPulseBuffer[buffer_index];
+  uint16_t size = WS2812A_PULSE_BUF_SIZE(pStrip);
+
+  if(pStrip->streaming)
+  {
+    /* both halves of the ring are encoded before the start; then each one again when DMA has sent it */
+    pStrip->stream_dev = 0;
+    pStrip->stream_zero = 0;
+    WS2812A_stream_fill(pStrip, pData);
+    WS2812A_stream_fill(pStrip, pData + WS2812A_STREAM_HALF_SIZE(pStrip));
+    size = WS2812A_STREAM_RING_SIZE(pStrip);
+  }
+
+  pStrip->tx_buffer_index = buffer_index;
+  HAL_StatusTypeDef status;
+#ifdef WS2812A_PARALLEL_OUTPUT
+  if(pStrip->pParallel != NULL)
+  {
+    /* every update event of the timer writes the next slot to the lanes */
+    TIM_HandleTypeDef* phTIM = pStrip->pParallel->phTIM;
+    status = HAL_DMA_Start_IT(phTIM->hdma[TIM_DMA_ID_UPDATE], (uint32_t)pData, (uint32_t)&pStrip->pParallel->pPort->ODR, size);
+    if(status == HAL_OK)
+    {
+      __HAL_TIM_SET_COUNTER(phTIM, 0);
+      __HAL_TIM_ENABLE_DMA(phTIM, TIM_DMA_UPDATE);
+      __HAL_TIM_ENABLE(phTIM);
+    }
+  }
+  else
+#endif
+  {
+    status = HAL_SPI_Transmit_DMA(pStrip->phSPI, pData, size);
+  }
+  if(status == HAL_OK)
+  {
+    pStrip->tx_busy = true;
+    if(pStrip->streaming)
+    {
+      streams_busy++;
+    }
+    WS2812A_stats.frames_sent++;
+    if(latency_pending)
+    {
+      /* the first strip started ends the measurement */
+      uint32_t latency = (WS2812A_STAMP() - latency_stamp) / WS2812A_STAMP_PER_US;
+      latency_pending = false;
+      WS2812A_stats.requested_frames++;
+      WS2812A_stats.latency_last = latency;
+      WS2812A_stats.latency_total += latency;
+      if(latency > WS2812A_stats.latency_max)
+      {
+        WS2812A_stats.latency_max = latency;
+      }
+    }
+  }
+  else
+  {
+    /* SPI not ready or DMA error */
+    pStrip->tx_busy = false;
+    WS2812A_stats.frames_dropped++;
+  }
+}
+
+/* returns the strip driven by the SPI or NULL if the SPI does not belong to the driver */
+static WS2812A_Strip_t* WS2812A_find_strip(SPI_HandleTypeDef* phSPI)
+{
+  uint8_t strip;
+
+  for(strip = 0; strip < number_of_strips; strip++)
+  {
+    if(WS2812A_strips[strip].phSPI == phSPI)
+    {
+      return &WS2812A_strips[strip];
+    }
+  }
+
+  return NULL;
+}
+
+/* encodes the next devices of a streamed strip into the half of the pulse ring; the half is padded with the latch after the last device */
+static void WS2812A_stream_fill(WS2812A_Strip_t* pStrip, uint8_t* pHalf)
+{
+  uint16_t numb_dev = pStrip->numb_dev - pStrip->stream_dev;
+
+  if(numb_dev == 0)
+  {
+    memset(pHalf, 0, WS2812A_STREAM_HALF_SIZE(pStrip));
+    pStrip->stream_zero++;
+    return;
+  }
+
+  if(numb_dev > WS2812A_STREAM_DEVS)
+  {
+    numb_dev = WS2812A_STREAM_DEVS;
+  }
+  WS2812A_encode_strip(pStrip, pStrip->stream_dev, pStrip->stream_dev + numb_dev - 1, pHalf);
+  memset(pHalf + numb_dev * pStrip->dev_size, 0, (WS2812A_STREAM_DEVS - numb_dev) * pStrip->dev_size);
+  pStrip->stream_dev += numb_dev;
+}
+
+/* DMA has sent the half of the pulse ring of a streamed strip; it is refilled unless a whole latch half has been sent */
+static void WS2812A_stream_next(WS2812A_Strip_t* pStrip, uint8_t* pHalf)
+{
+  if(pStrip->stream_zero < 2)
+  {
+    WS2812A_stream_fill(pStrip, pHalf);
+    return;
+  }
+
+  /* the half sent and the half in transmission are both latch halves - the line stays low when DMA stops */
+  HAL_SPI_DMAStop(pStrip->phSPI);
+  WS2812A_stream_end(pStrip);
+}
+
+/* ends the transmission of a streamed strip; a frame postponed by the transmissions runs now */
+static void WS2812A_stream_end(WS2812A_Strip_t* pStrip)
+{
+  pStrip->tx_busy = false;
+  if((--streams_busy == 0) && frame_postponed)
+  {
+    frame_postponed = false;
+    UTIL_SEQ_SetTask(WS2812A_TASK, 1);
+  }
+}
+
+/* SPI DMA has sent the first half of the buffer; only the pulse ring of a streamed strip is refilled */
+void HAL_SPI_TxHalfCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  WS2812A_Strip_t* pStrip = WS2812A_find_strip(hspi);
+  if((pStrip != NULL) && pStrip->streaming && pStrip->tx_busy)
+  {
+    WS2812A_stream_next(pStrip, pStrip->pPulseBuffer[0]);
+  }
+}
+
+/* SPI DMA transmission complete; the buffer returns to the encoder and a deferred frame is started;
+   circular DMA of a streamed strip continues with the first half of the pulse ring */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  WS2812A_Strip_t* pStrip = WS2812A_find_strip(hspi);
+  if(pStrip == NULL)
+  {
+    return;
+  }
+
+  if(pStrip->streaming)
+  {
+    if(pStrip->tx_busy)
+    {
+      WS2812A_stream_next(pStrip, pStrip->pPulseBuffer[0] + WS2812A_STREAM_HALF_SIZE(pStrip));
+    }
+    return;
+  }
+
+  WS2812A_tx_complete(pStrip);
+}
+
+/* the transmission of the buffer has ended; the buffer returns to the encoder and a deferred frame is started */
+static void WS2812A_tx_complete(WS2812A_Strip_t* pStrip)
+{
+  pStrip->tx_busy = false;
+  if(pStrip->tx_pending)
+  {
+    pStrip->tx_pending = false;
+    WS2812A_start_DMA(pStrip, (pStrip->tx_buffer_index + 1) % WS2812A_NUMB_PULSE_BUF);
+  }
+}
+
+/* SPI transmission error; the frame is lost and the next one starts from the free buffer */
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+  WS2812A_Strip_t* pStrip = WS2812A_find_strip(hspi);
+  if(pStrip == NULL)
+  {
+    return;
+  }
+
+  if(pStrip->streaming && pStrip->tx_busy)
+  {
+    WS2812A_stream_end(pStrip);
+  }
+  pStrip->tx_busy = false;
+  WS2812A_stats.frames_dropped++;
+}
+
+/* starts the transition of the global color to the XY color;
+   components are interpolated in XY space if the current color is known in XY space, otherwise in RGB space */
+static void WS2812A_start_color_transition(XY_t target_xy, uint32_t transition_time)
+{
+  if(!color_xy_valid)
+  {
+    /* the RGB target is converted once */
+    WS2812A_start_rgb_transition(convert_XY_to_RGB(target_xy), transition_time);
+    /* the XY color becomes valid when the RGB transition ends */
+    color_xy_current = target_xy;
+    color_transition.xy_at_end = true;
+    return;
+  }
+
+  color_transition.space = WS2812A_SPACE_XY;
+  ANIM_Set(ANIM_X, (uint32_t)color_xy_current.X << 16);
+  ANIM_Set(ANIM_Y, (uint32_t)color_xy_current.Y << 16);
+  ANIM_Start(ANIM_X, ((int32_t)target_xy.X - color_xy_current.X) * (int64_t)ANIM_ONE, transition_time, frame_tick);
+  ANIM_Start(ANIM_Y, ((int32_t)target_xy.Y - color_xy_current.Y) * (int64_t)ANIM_ONE, transition_time, frame_tick);
+  color_transition.xy_at_end = true;
+  color_transition.active = true;
+}
+
+/* starts the transition of the global color from the current RGB color to the RGB color */
+static void WS2812A_start_rgb_transition(RGB_t target_rgb, uint32_t transition_time)
+{
+  color_transition.space = WS2812A_SPACE_RGB;
+  ANIM_Set(ANIM_RED, (uint32_t)light_params.color_rgb.R << 16);
+  ANIM_Set(ANIM_GREEN, (uint32_t)light_params.color_rgb.G << 16);
+  ANIM_Set(ANIM_BLUE, (uint32_t)light_params.color_rgb.B << 16);
+  ANIM_Start(ANIM_RED, ((int32_t)target_rgb.R - light_params.color_rgb.R) * (int64_t)ANIM_ONE, transition_time, frame_tick);
+  ANIM_Start(ANIM_GREEN, ((int32_t)target_rgb.G - light_params.color_rgb.G) * (int64_t)ANIM_ONE, transition_time, frame_tick);
+  ANIM_Start(ANIM_BLUE, ((int32_t)target_rgb.B - light_params.color_rgb.B) * (int64_t)ANIM_ONE, transition_time, frame_tick);
+  color_transition.xy_at_end = false;
+  color_transition.active = true;
+}
+
+/* stops the global color transition at the current color */
+static void WS2812A_stop_color_transition(void)
+{
+  if(color_transition.active)
+  {
+    color_transition.active = false;
+    ANIM_Stop(ANIM_X);
+    ANIM_Stop(ANIM_Y);
+    ANIM_Stop(ANIM_RED);
+    ANIM_Stop(ANIM_GREEN);
+    ANIM_Stop(ANIM_BLUE);
+  }
+}
+
+/* sets the color of all devices from the components of the global color transition advanced in this frame */
+static void WS2812A_step_color_transition(void)
+{
+  bool active;
+
+  if(color_transition.space == WS2812A_SPACE_XY)
+  {
+    /* rounded to the nearest XY unit */
+    color_xy_current.X = (ANIM_Value(ANIM_X) + 0x8000) >> 16;
+    color_xy_current.Y = (ANIM_Value(ANIM_Y) + 0x8000) >> 16;
+    light_params.color_rgb = convert_XY_to_RGB(color_xy_current);
+    active = ANIM_Active(ANIM_X) || ANIM_Active(ANIM_Y);
+  }
+  else
+  {
+    light_params.color_rgb.R = (ANIM_Value(ANIM_RED) + 0x8000) >> 16;
+    light_params.color_rgb.G = (ANIM_Value(ANIM_GREEN) + 0x8000) >> 16;
+    light_params.color_rgb.B = (ANIM_Value(ANIM_BLUE) + 0x8000) >> 16;
+    active = ANIM_Active(ANIM_RED) || ANIM_Active(ANIM_GREEN) || ANIM_Active(ANIM_BLUE);
+  }
+
+  if(!active)
+  {
+    /* the transition has reached its target */
+    color_transition.active = false;
+    color_xy_valid = color_transition.xy_at_end;
+  }
+
+  WS2812A_set_devices(0, number_of_devices, light_params.color_rgb);
+}
+
+/* reports the remaining color transition time when its value in 1/10 s changes */
+static void WS2812A_report_remaining_time(void)
+{
+  uint32_t remaining_time = 0;
+  uint8_t channel;
+  for(channel = ANIM_HUE; channel <= ANIM_BLUE; channel++)
+  {
+    uint32_t channel_time = ANIM_Remaining((ANIM_ChannelTypeDef)channel, frame_tick);
+    if(channel_time > remaining_time)
+    {
+      remaining_time = channel_time;
+    }
+  }
+  remaining_time = (remaining_time + 99) / 100;
+  if(remaining_time > UINT16_MAX)
+  {
+    remaining_time = UINT16_MAX;
+  }
+  if(remaining_time != remaining_time_reported)
+  {
+    remaining_time_reported = (uint16_t)remaining_time;
+    WS2812A_RemainingTimeCallback(remaining_time_reported);
+  }
+}
+
+/**
+ * @brief Remaining color transition time callback, called from the frame task whenever the value changes.
+ *
+ * @param remaining_time  Remaining transition time [1/10 s].
+ *
+ * @note This function should not be modified; when the callback is needed it should be implemented by the application.
+ */
+__weak void WS2812A_RemainingTimeCallback(uint16_t remaining_time)
+{
+  UNUSED(remaining_time);
+}
+
+/**
+ * @brief Hue and saturation callback, called from the frame task when a hue or saturation change ends or is stopped.
+ *
+ * @param enh_hue  Enhanced hue <0,0xFFFF>.
+ * @param sat      Saturation <0,WS2812A_MAX_SAT>.
+ *
+ * @note This function should not be modified; when the callback is needed it should be implemented by the application.
+ */
+__weak void WS2812A_HueSatCallback(uint16_t enh_hue, uint8_t sat)
+{
+  UNUSED(enh_hue);
+  UNUSED(sat);
+}
+
+/**
+ * @brief Move the hue and/or saturation to the given values.
+ *
+ * @param components       WS2812A_HUE and/or WS2812A_SAT.
+ * @param enh_hue          Target enhanced hue <0,0xFFFF>.
+ * @param sat              Target saturation <0,WS2812A_MAX_SAT>.
+ * @param direction        Direction of the hue change around the hue circle.
+ * @param transition_time  Transition time [ms].
+ */
+static void WS2812A_hue_sat_move_to(uint8_t components, uint16_t enh_hue, uint8_t sat, WS2812A_HueDirTypeDef direction, uint32_t transition_time)
+{
+  if(!color_hs_valid)
+  {
+    /* the current color is unknown in HS space: the new values are set at once and the color fades in RGB space */
+    WS2812A_start_channel(ANIM_HUE, 0, 0);
+    WS2812A_start_channel(ANIM_SAT, 0, 0);
+    if((components & WS2812A_HUE) != 0)
+    {
+      ANIM_Set(ANIM_HUE, (uint32_t)enh_hue << 16);
+    }
+    if((components & WS2812A_SAT) != 0)
+    {
+      ANIM_Set(ANIM_SAT, (uint32_t)((sat > WS2812A_MAX_SAT) ? WS2812A_MAX_SAT : sat) << 16);
+    }
+    hs_fade_time = transition_time;
+    light_params.set_color_HS = true;
+    return;
+  }
+
+  if((components & WS2812A_HUE) != 0)
+  {
+    uint16_t hue = ANIM_Value(ANIM_HUE) >> 16;
+    int32_t distance_up = (uint16_t)(enh_hue - hue);
+    int32_t distance_down = (uint16_t)(hue - enh_hue);
+    int32_t change;
+    switch(direction)
+    {
+      case WS2812A_HUE_SHORTEST:
+      change = (distance_up <= distance_down) ? distance_up : -distance_down;
+      break;
+
+      case WS2812A_HUE_LONGEST:
+      change = (distance_up > distance_down) ? distance_up : -distance_down;
+      break;
+
+      case WS2812A_HUE_UP:
+      change = distance_up;
+      break;
+
+      default:
+      change = -distance_down;
+      break;
+    }
+    WS2812A_start_channel(ANIM_HUE, change, transition_time);
+  }
+
+  if((components & WS2812A_SAT) != 0)
+  {
+    if(sat > WS2812A_MAX_SAT)
+    {
+      sat = WS2812A_MAX_SAT;
+    }
+    WS2812A_start_channel(ANIM_SAT, (int32_t)sat - (int32_t)(ANIM_Value(ANIM_SAT) >> 16), transition_time);
+  }
+
+  light_params.set_color_HS = true;
+}
+
+/**
+ * @brief Start, stop or change a continuous hue and/or saturation movement.
+ * The hue moves around the hue circle until stopped; the saturation stops at its limits.
+ *
+ * @param components  WS2812A_HUE and/or WS2812A_SAT.
+ * @param rate        Hue change in enhanced hue units per second or saturation change in units per second;
+ *                    negative = decrease, 0 = stop the movement of the components.
+ */
+static void WS2812A_hue_sat_move(uint8_t components, int32_t rate)
+{
+  if((components & WS2812A_HUE) != 0)
+  {
+    /* continuous move */
+    ANIM_Move(ANIM_HUE, (int64_t)rate * ANIM_ONE, HAL_GetTick());
+  }
+
+  if((components & WS2812A_SAT) != 0)
+  {
+    int32_t sat = ANIM_Value(ANIM_SAT) >> 16;
+    if(rate > 0)
+    {
+      /* increase saturation toward the maximum like WS2812A_brightness_move() does */
+      WS2812A_start_channel(ANIM_SAT, WS2812A_MAX_SAT - sat, (uint32_t)(WS2812A_MAX_SAT - sat) * 1000 / (uint32_t)rate);
+    }
+    else if(rate < 0)
+    {
+      WS2812A_start_channel(ANIM_SAT, -sat, (uint32_t)sat * 1000 / (uint32_t)(-rate));
+    }
+    else
+    {
+      WS2812A_start_channel(ANIM_SAT, 0, 0);
+    }
+  }
+
+  light_params.set_color_HS = true;
+}
+
+/**
+ * @brief Step the hue and/or saturation.
+ *
+ * @param components       WS2812A_HUE and/or WS2812A_SAT.
+ * @param step             Hue change in enhanced hue units or saturation change; negative = decrease.
+ * @param transition_time  Transition time [ms].
+ */
+static void WS2812A_hue_sat_step(uint8_t components, int32_t step, uint32_t transition_time)
+{
+  if((components & WS2812A_HUE) != 0)
+  {
+    WS2812A_start_channel(ANIM_HUE, step, transition_time);
+  }
+
+  if((components & WS2812A_SAT) != 0)
+  {
+    int32_t sat = (int32_t)(ANIM_Value(ANIM_SAT) >> 16) + step;
+    sat = (sat < 0) ? 0 : ((sat > WS2812A_MAX_SAT) ? WS2812A_MAX_SAT : sat);
+    WS2812A_start_channel(ANIM_SAT, sat - (int32_t)(ANIM_Value(ANIM_SAT) >> 16), transition_time);
+  }
+
+  light_params.set_color_HS = true;
+}
+
+/**
+ * @brief Color temperature callback, called from the frame task when a color temperature change ends or is stopped.
+ *
+ * @param color_temp  Color temperature [mireds].
+ *
+ * @note This function should not be modified; when the callback is needed it should be implemented by the application.
+ */
+__weak void WS2812A_ColorTempCallback(uint16_t color_temp)
+{
+  UNUSED(color_temp);
+}
+
+/**
+ * @brief Move the color temperature to the given value.
+ *
+ * @param color_temp       Target color temperature [mireds]; limited to <COLOR_TEMP_MIN,COLOR_TEMP_MAX>.
+ * @param transition_time  Transition time [ms].
+ */
+static void WS2812A_color_temp_move_to(uint16_t color_temp, uint32_t transition_time)
+{
+  uint16_t current = WS2812A_start_temp(COLOR_TEMP_MIN, COLOR_TEMP_MAX);
+  color_temp = (color_temp < COLOR_TEMP_MIN) ? COLOR_TEMP_MIN : ((color_temp > COLOR_TEMP_MAX) ? COLOR_TEMP_MAX : color_temp);
+
+  if(!color_temp_valid)
+  {
+    /* the current color is not a color temperature: the new value is set at once and the color fades in RGB space */
+    WS2812A_start_channel(ANIM_MIREDS, (int32_t)color_temp - current, 0);
+    temp_fade_time = transition_time;
+  }
+  else
+  {
+    WS2812A_start_channel(ANIM_MIREDS, (int32_t)color_temp - current, transition_time);
+  }
+  light_params.color_temp = color_temp;
+  light_params.set_color_temp = true;
+}
+
+/**
+ * @brief Start, stop or change a continuous color temperature movement toward a limit.
+ *
+ * @param rate      Color temperature change in mireds per second; negative = decrease, 0 = stop.
+ * @param temp_min  The lowest color temperature of the move [mireds]; 0 = COLOR_TEMP_MIN.
+ * @param temp_max  The highest color temperature of the move [mireds]; 0 = COLOR_TEMP_MAX.
+ */
+static void WS2812A_color_temp_move(int32_t rate, uint16_t temp_min, uint16_t temp_max)
+{
+  int32_t current = WS2812A_start_temp(temp_min, temp_max);
+  temp_min = (temp_min < COLOR_TEMP_MIN) ? COLOR_TEMP_MIN : temp_min;
+  temp_max = ((temp_max == 0) || (temp_max > COLOR_TEMP_MAX)) ? COLOR_TEMP_MAX : temp_max;
+
+  if((rate > 0) && (current < temp_max))
+  {
+    /* like WS2812A_brightness_move() the move is a transition to the limit */
+    WS2812A_start_channel(ANIM_MIREDS, temp_max - current, (uint32_t)(temp_max - current) * 1000 / (uint32_t)rate);
+  }
+  else if((rate < 0) && (current > temp_min))
+  {
+    WS2812A_start_channel(ANIM_MIREDS, temp_min - current, (uint32_t)(current - temp_min) * 1000 / (uint32_t)(-rate));
+  }
+  else
+  {
+    ANIM_Stop(ANIM_MIREDS);
+  }
+  light_params.color_temp = ANIM_Target(ANIM_MIREDS) >> 16;
+  light_params.set_color_temp = true;
+}
+
+/**
+ * @brief Step the color temperature.
+ *
+ * @param step             Color temperature change [mireds]; negative = decrease.
+ * @param transition_time  Transition time [ms].
+ * @param temp_min         The lowest color temperature of the step [mireds]; 0 = COLOR_TEMP_MIN.
+ * @param temp_max         The highest color temperature of the step [mireds]; 0 = COLOR_TEMP_MAX.
+ */
+static void WS2812A_color_temp_step(int32_t step, uint32_t transition_time, uint16_t temp_min, uint16_t temp_max)
+{
+  int32_t current = WS2812A_start_temp(temp_min, temp_max);
+  int32_t target = current + step;
+  temp_min = (temp_min < COLOR_TEMP_MIN) ? COLOR_TEMP_MIN : temp_min;
+  temp_max = ((temp_max == 0) || (temp_max > COLOR_TEMP_MAX)) ? COLOR_TEMP_MAX : temp_max;
+  target = (target < temp_min) ? temp_min : ((target > temp_max) ? temp_max : target);
 
-static SPI_HandleTypeDef* pWS2812A_SPI;
-static uint8_t WS2812A_pulse_buffer[WS2812A_PULSE_BUF_SIZE];
-static RGB_t WS2812A_RGB_data[WS2812A_NUMB_DEV];
-static float level_current = 0.0f;   /* current light level <0.0,255.0> */
-static uint16_t group_size[WS2812A_NUMB_DEV]; /* number of devices in groups, number of groups <= number of devices */
-static uint16_t number_of_groups = 0;   /* number of groups */
-static WS2812A_ColorLoopTypeDef last_color_loop_mode = COLOR_LOOP_NUMB_MODES;   /* used for mode change detection */
+  WS2812A_start_channel(ANIM_MIREDS, target - current, transition_time);
+  light_params.color_temp = ANIM_Target(ANIM_MIREDS) >> 16;
+  light_params.set_color_temp = true;
+}
 
-Light_Params_t light_params =
+/**
+ * @brief Stop all color changes in progress at the current frame: hue, saturation and color temperature moves
+ *        and the color transition.
+ */
+static void WS2812A_color_move_stop(void)
 {
-    .level_target = 0,
-    .level_on = WS2812A_START_ON_LEVEL,
-    .transition_time = 0,
-    .set_color_XY = false,
-    .set_color_HS = false,
-    .set_color_temp = false,
-    .color_restore = false,
-    .color_mode = COLOR_STATIC,
-    .color_loop_mode = COLOR_LOOP_CYCLIC_ALL_FAST,
-    .color_rgb = {WS2812A_RGB_WHITE, WS2812A_RGB_WHITE, WS2812A_RGB_WHITE}
-};
+  WS2812A_stop_hue_sat();
+  ANIM_Stop(ANIM_MIREDS);
+  WS2812A_stop_color_transition();
+}
 
-void WS2812A_handler(void);
-void color_loop_cycling(float period, bool use_groups);
-void color_loop_random(float period, bool use_groups);
-void color_loop_comet(float travel_time, float mean_interval);
+/* returns the current color temperature limited to the given range as the start point of a move or step;
+   if the current color is not a color temperature, the last color temperature is used */
+static uint16_t WS2812A_start_temp(uint16_t temp_min, uint16_t temp_max)
+{
+  uint16_t current = color_temp_valid ? (ANIM_Value(ANIM_MIREDS) >> 16) : light_params.color_temp;
+  temp_min = (temp_min < COLOR_TEMP_MIN) ? COLOR_TEMP_MIN : temp_min;
+  temp_max = ((temp_max == 0) || (temp_max > COLOR_TEMP_MAX)) ? COLOR_TEMP_MAX : temp_max;
+  current = (current < temp_min) ? temp_min : ((current > temp_max) ? temp_max : current);
+  ANIM_Set(ANIM_MIREDS, (uint32_t)current << 16);
+  return current;
+}
 
-void WS2812A_Init(SPI_HandleTypeDef* phSPI)
+/* sets the color of all devices from the color temperature table at the color temperature advanced in this frame */
+static void WS2812A_step_temp(void)
 {
-  pWS2812A_SPI = phSPI;
+  light_params.color_temp = (ANIM_Value(ANIM_MIREDS) + 0x8000) >> 16;
+  light_params.color_rgb = convert_temp_to_RGB(light_params.color_temp);
+  WS2812A_set_devices(0, number_of_devices, light_params.color_rgb);
+}
 
-  /* initialize RGB buffer with white color values */
-  memset(WS2812A_RGB_data, WS2812A_RGB_WHITE, sizeof(WS2812A_RGB_data));
+/* starts the change of the color channel by the number of units in the given time from its current value;
+   the fraction of a stopped move is dropped so that the transition ends at a whole unit */
+static void WS2812A_start_channel(ANIM_ChannelTypeDef channel, int32_t change, uint32_t transition_time)
+{
+  ANIM_Set(channel, ANIM_Value(channel) & 0xFFFF0000);
+  ANIM_Start(channel, (int64_t)change * ANIM_ONE, transition_time, HAL_GetTick());
+}
 
-  /* define groups */
-  uint16_t group;
-  number_of_groups = WS2812A_NUMB_DEV;
-  for(group = 0; group < number_of_groups; group++)
-  {
-    group_size[group] = 1;
-  }
+/* stops the hue and saturation at their current values */
+static void WS2812A_stop_hue_sat(void)
+{
+  ANIM_Stop(ANIM_HUE);
+  ANIM_Stop(ANIM_SAT);
+}
 
-  /* register WS2812A handler task */
-  UTIL_SEQ_RegTask(WS2812A_TASK, 0, WS2812A_handler);
+/* returns true if the hue or saturation is changing */
+static inline bool WS2812A_hs_active(void)
+{
+  return ANIM_Active(ANIM_HUE) || ANIM_Active(ANIM_SAT);
 }
 
-/* takes 8 bits and generates 8 5-bit pulses in the buffer */
-void bits_to_pulses(uint8_t color_value, uint8_t** ppBuffer)
+/* sets the color of all devices from the hue and saturation advanced in this frame */
+static void WS2812A_step_hue_sat(void)
+{
+  light_params.color_hs.hue = ANIM_Value(ANIM_HUE) >> 24;
+  light_params.color_hs.sat = ANIM_Value(ANIM_SAT) >> 16;
+  light_params.color_rgb = convert_HSV_to_RGB(ANIM_Value(ANIM_HUE) >> 16, light_params.color_hs.sat);
+  WS2812A_set_devices(0, number_of_devices, light_params.color_rgb);
+}
+
+/* returns the frame transmission statistics */
+const WS2812A_Stats_t* WS2812A_GetStats(void)
 {
-  uint64_t pulse_buffer = 0;
-  uint8_t bit_index;
+  return &WS2812A_stats;
+}
+
+/* returns the fully saturated color of the palette at the position <0,255> */
+static RGB_t WS2812A_palette_color(WS2812A_PaletteTypeDef palette, uint8_t position)
+{
+  const WS2812A_Palette_t* pPalette = &WS2812A_palettes[(palette < WS2812A_NUMB_PALETTES) ? palette : WS2812A_PALETTE_RAINBOW];
+  HS_t color_hs;
 
-  for(bit_index = 0; bit_index < 8; bit_index++)
+  if(pPalette->hue_span < 0x100)
   {
-    pulse_buffer <<= 5;
-    pulse_buffer |= ((color_value & 0x80) != 0 ? WS2812A_PULSE_ONE : WS2812A_PULSE_ZERO);
-    color_value <<= 1;
+    /* a palette narrower than the hue circle is traversed forth and back to keep the cycle continuous */
+    position = (position < 0x80) ? (uint8_t)(position << 1) : (uint8_t)((0xFF - position) << 1);
   }
-
-  **ppBuffer = (pulse_buffer >> 32) & 0xFF;
-  (*ppBuffer)++;
-  **ppBuffer = (pulse_buffer >> 24) & 0xFF;
-  (*ppBuffer)++;
-  **ppBuffer = (pulse_buffer >> 16) & 0xFF;
-  (*ppBuffer)++;
-  **ppBuffer = (pulse_buffer >> 8) & 0xFF;
-  (*ppBuffer)++;
-  **ppBuffer = pulse_buffer & 0xFF;
-  (*ppBuffer)++;
+  color_hs.hue = pPalette->first_hue + ((position * pPalette->hue_span) >> 8);
+  color_hs.sat = MAX_SAT;
+  return convert_HS_to_RGB(color_hs);
 }
 
-void WS2812A_handler(void)
+/* returns the effect of the index; the indexes following the registry play the animation assets */
+static const WS2812A_Effect_t* WS2812A_get_effect(uint8_t index)
 {
-  bool transmit_request = false;
+  return (index < WS2812A_NUMB_EFFECTS) ? &WS2812A_effects[index] : &WS2812A_playback;
+}
 
-  /* check if global color must be set */
-  if(light_params.set_color_XY | light_params.set_color_HS | light_params.set_color_temp | light_params.color_restore)
+/* returns a random number <0,bound) from the stream of the running effect; the buffer is refilled in bulk */
+static uint32_t WS2812A_random(uint32_t bound)
+{
+  if(random_used >= WS2812A_RANDOM_BUF_SIZE)
   {
-    /* set a global color */
+    PRNG_Fill(&effect_streams[effect_running], random_buffer, WS2812A_RANDOM_BUF_SIZE);
+    random_used = 0;
+  }
+  return (uint32_t)(((uint64_t)random_buffer[random_used++] * bound) >> 32);
+}
 
-    if(light_params.set_color_XY)
+/* starts the move of the cycling phase by a full turn (2^32) per speed period; also applies changed parameters */
+static void WS2812A_cycling_init(void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  ANIM_Move(ANIM_EFFECT, (int64_t)(1000ULL << 32) / (pParams->speed ? pParams->speed : 1), frame_tick);
+
+#ifdef WS2812A_INDEXED_COLORS
+  /* the groups covering all devices get the palette entries cycled instead of their devices; more groups than entries share them */
+  WS2812A_CyclingState_t* pCycling = pState;
+  uint32_t numb_covered = 0;
+  uint16_t group;
+  for(group = 0; group < number_of_groups; group++)
+  {
+    numb_covered += group_size[group];
+  }
+  pCycling->numb_entries = 0;
+  if(numb_covered == number_of_devices)
+  {
+    uint16_t dev_index = 0;
+    pCycling->numb_entries = !pParams->use_groups ? 1 : (number_of_groups < WS2812A_NUMB_COLORS) ? number_of_groups : WS2812A_NUMB_COLORS;
+    for(group = 0; group < number_of_groups; group++)
     {
-      /* set a global color from XY space */
-      light_params.color_rgb = convert_XY_to_RGB(light_params.color_xy);
-      /* mark as done */
-      light_params.set_color_XY = false;          
+      uint8_t index = (uint8_t)((uint32_t)group * pCycling->numb_entries / number_of_groups);
+      uint16_t device;
+      for(device = 0; device < group_size[group]; device++)
+      {
+        WS2812A_set_device_index(dev_index++, index);
+      }
     }
-    else if(light_params.set_color_HS)
+  }
+#else
+  UNUSED(pState);
+#endif
+}
+
+/* cycles all devices or groups through the palette */
+static void WS2812A_cycling_render(void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  uint16_t group;
+  uint16_t dev_index = 0;  /* index of the device to be set */
+  RGB_t color_rgb;
+  uint32_t phase0 = ANIM_Value(ANIM_EFFECT);
+
+#ifdef WS2812A_INDEXED_COLORS
+  const WS2812A_CyclingState_t* pCycling = pState;
+  if(pCycling->numb_entries != 0)
+  {
+    /* the palette rotates; the devices keep their entries */
+    uint16_t index;
+    for(index = 0; index < pCycling->numb_entries; index++)
     {
-      /* set a global color from HS space */
-      //TODO implement HS to RGB
-      /* mark as done */
-      light_params.set_color_HS = false;        
+      uint32_t offset = (uint32_t)(((uint64_t)index << 32) / pCycling->numb_entries);
+      uint32_t phase = (light_params.loop_direction == 0) ? phase0 + offset : phase0 - offset;
+      WS2812A_set_palette((uint8_t)index, WS2812A_palette_color(pParams->palette, phase >> 24));
     }
-    else if(light_params.set_color_temp)
+    return;
+  }
+#else
+  UNUSED(pState);
+#endif
+
+  /* set all groups */
+  for(group = 0; group < number_of_groups; group++)
+  {
+    uint16_t device;
+    uint32_t phase = phase0;
+    if(pParams->use_groups)
     {
-      /* convert color temperature to XY */
-      light_params.color_xy = convert_temp_to_XY(light_params.color_temp);
-      /* set a global color from XY space */
-      light_params.color_rgb = convert_XY_to_RGB(light_params.color_xy);
-      /* mark as done */
-      light_params.set_color_temp = false;        
+      /* the phase wraps around in the 32-bit value */
+      uint32_t offset = (uint32_t)(((uint64_t)group << 32) / number_of_groups);
+      phase = (light_params.loop_direction == 0) ? phase0 + offset : phase0 - offset;
     }
-    else if(light_params.color_restore)
+    color_rgb = WS2812A_palette_color(pParams->palette, phase >> 24);
+    /* set all devices in a group */
+    for(device = 0; device < group_size[group]; device++)
     {
-      light_params.color_restore = false;
-      /* do nothing else - just restore static RGB color */
+      if(dev_index < number_of_devices)
+      {
+        WS2812A_set_device(dev_index++, color_rgb);
+      }
     }
+  }
+}
+
+/* a palette step of the cycling phase */
+static uint32_t WS2812A_cycling_step_time(const void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  UNUSED(pState);
+  UNUSED(pParams);
+  return ANIM_StepTime(ANIM_EFFECT, 1UL << 24);
+}
+
+/* sets random colors of all devices or groups */
+static void WS2812A_random_init(void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  uint16_t group_index = 0;
+  uint16_t group;
+  RGB_t color_rgb_init;
 
-    uint16_t dev_index;
-    for(dev_index = 0; dev_index < WS2812A_NUMB_DEV; dev_index++)
+  UNUSED(pState);
+  for(group = 0; group < number_of_groups; group++)
+  {
+    if((group == 0) || (pParams->use_groups))
     {
-      WS2812A_RGB_data[dev_index] = light_params.color_rgb;
-    }       
+      /* set new init color */
+      color_rgb_init = WS2812A_palette_color(pParams->palette, WS2812A_random(0x100));
+    }
 
-    /* global color sets color mode to static */
-    light_params.color_mode = COLOR_STATIC;
-    /* apply change by transmission to devices */
-    transmit_request = true;
+    WS2812A_set_devices(group_index, group_size[group], color_rgb_init);
+    group_index += group_size[group];
   }
+  /* the first fade starts in the first frame */
+  ANIM_Stop(ANIM_EFFECT);
+}
 
-  /* check if color mode loop is active */
-  if(light_params.color_mode == COLOR_LOOP)
+/* fades all devices or a random group to a random color in the speed period */
+static void WS2812A_random_render(void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  WS2812A_RandomState_t* pRandom = pState;
+  uint16_t group_index;
+  uint16_t group;
+
+  /* check if the fade has reached the target color */
+  if(!ANIM_Active(ANIM_EFFECT))
   {
-    switch(light_params.color_loop_mode)
+    /* set new active group; 0 if groups not used */
+    pRandom->group_active = pParams->use_groups ? WS2812A_random(number_of_groups) : 0;
+    /* set new target color */
+    pRandom->color_rgb_target = WS2812A_palette_color(pParams->palette, WS2812A_random(0x100));
+    /* set start color from acitve group data */
+    group_index = 0;
+    for(group = 0; group < pRandom->group_active; group++)
     {
-      case COLOR_LOOP_CYCLIC_GROUPS_FAST:
-      color_loop_cycling(10.0f, true);
-      break;
-      
-      case COLOR_LOOP_CYCLIC_GROUPS_SLOW:
-      color_loop_cycling(60.0f, true);
-      break;
-
-      case COLOR_LOOP_CYCLIC_ALL_FAST:
-      color_loop_cycling(10.0f, false);
-      break;
+      group_index += group_size[group];
+    }
+    pRandom->color_rgb_start = WS2812A_get_device(group_index);
+    /* the fade progress goes from 0 to ANIM_ONE */
+    ANIM_Set(ANIM_EFFECT, 0);
+    ANIM_Start(ANIM_EFFECT, ANIM_ONE, pParams->speed, frame_tick);
+  }
 
-      case COLOR_LOOP_CYCLIC_ALL_SLOW:
-      color_loop_cycling(60.0f, false);
-      break;
+  /* the current color of the fade */
+  int32_t progress = (int32_t)ANIM_Value(ANIM_EFFECT);
+  RGB_t color_rgb_current;
+  color_rgb_current.R = pRandom->color_rgb_start.R + ((((int32_t)pRandom->color_rgb_target.R - pRandom->color_rgb_start.R) * progress) >> 16);
+  color_rgb_current.G = pRandom->color_rgb_start.G + ((((int32_t)pRandom->color_rgb_target.G - pRandom->color_rgb_start.G) * progress) >> 16);
+  color_rgb_current.B = pRandom->color_rgb_start.B + ((((int32_t)pRandom->color_rgb_target.B - pRandom->color_rgb_start.B) * progress) >> 16);
 
-      case COLOR_LOOP_RANDOM_GROUPS_FAST:
-      color_loop_random(0.5f, true);
-      break;
+  group_index = 0;
+  for(group = 0; group < number_of_groups; group++)
+  {
+    if((!pParams->use_groups) || (group == pRandom->group_active))
+    {
+      WS2812A_set_devices(group_index, group_size[group], color_rgb_current);
+    }
+    group_index += group_size[group];
+  }
+}
 
-      case COLOR_LOOP_RANDOM_GROUPS_SLOW:
-      color_loop_random(10.0f, true);
-      break;
+/* a color step of the fade; the progress goes from 0 to ANIM_ONE */
+static uint32_t WS2812A_random_step_time(const void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  UNUSED(pState);
+  /* a new fade starts in the next frame */
+  return ANIM_Active(ANIM_EFFECT) ? ANIM_StepTime(ANIM_EFFECT, ANIM_ONE / 0x100) : pParams->speed / 0x100;
+}
 
-      case COLOR_LOOP_RANDOM_ALL_FAST:
-      color_loop_random(5.0f, false);
-      break;
+/* starts the comet position at the strip start */
+static void WS2812A_comet_init(void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  ANIM_Set(ANIM_EFFECT, 0);
+  WS2812A_comet_param(pState, pParams);
+}
 
-      case COLOR_LOOP_RANDOM_ALL_SLOW:
-      color_loop_random(60.0f, false);
-      break;
+/* moves the comet position by the number of devices per speed period (travel time) */
+static void WS2812A_comet_param(void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  UNUSED(pState);
+  ANIM_Move(ANIM_EFFECT, ((int64_t)number_of_devices * ANIM_ONE * 1000) / (pParams->speed ? pParams->speed : 1), frame_tick);
+}
 
-      case COLOR_LOOP_COMET_FREQUENT:
-      color_loop_comet(1.0f, 3.0f);
-      break;
+/* scrolls comets along the strip; a new comet starts every density interval on average */
+static void WS2812A_comet_render(void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  WS2812A_CometState_t* pComet = pState;
 
-      case COLOR_LOOP_COMET_RARE:
-      color_loop_comet(1.0f, 10.0f);
-      break;       
+  /* a late frame makes all the steps due since the previous frame */
+  uint16_t steps = (uint16_t)((ANIM_Value(ANIM_EFFECT) >> 16) - pComet->position);
+  pComet->position += steps;
+  if(steps > number_of_devices)
+  {
+    steps = number_of_devices;
+  }
+  for(; steps > 0; steps--)
+  {
+    /* the step moves the ring head; the tail fades out at the strip end */
+    RGB_t tail = WS2812A_get_device(number_of_devices - 1);
+    WS2812A_scroll();
+    tail.R >>= 1;
+    tail.G >>= 1;
+    tail.B >>= 1;
+    WS2812A_set_device(number_of_devices - 1, tail);
+  }
 
-      default:
-      break;
-    }
-    last_color_loop_mode = light_params.color_loop_mode;
-    /* apply change by transmission to devices */
-    transmit_request = true; 
+  RGB_t last = WS2812A_get_device(number_of_devices - 1);
+  uint32_t propability_ratio = pParams->density / (frame_elapsed ? frame_elapsed : 1);
+  if(((propability_ratio == 0) || (WS2812A_random(propability_ratio) == 0)) &&
+     (last.R == 0) && (last.G == 0) && (last.B == 0))
+  {
+    WS2812A_set_device(number_of_devices - 1, WS2812A_palette_color(pParams->palette, WS2812A_random(0x100)));
   }
+}
+
+/* a step of the comets by one device */
+static uint32_t WS2812A_comet_step_time(const void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  UNUSED(pState);
+  UNUSED(pParams);
+  return ANIM_StepTime(ANIM_EFFECT, ANIM_ONE);
+}
 
-  /* check if the current level must be changed */
-  if((uint8_t)level_current != light_params.level_target)
+/* clears the strip for the comets of the particle pool */
+static void WS2812A_particles_init(void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  RGB_t black = { 0, 0, 0 };
+
+  UNUSED(pState);
+  UNUSED(pParams);
+  WS2812A_set_devices(0, number_of_devices, black);
+}
+
+/* moves independent comets of various colors and speeds from the end to the start of the strip;
+   only the devices of the comets are redrawn, a new comet starts every density interval on average */
+static void WS2812A_particles_render(void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  WS2812A_ParticleState_t* pPool = pState;
+  const RGB_t black = { 0, 0, 0 };
+  WS2812A_Particle_t* pParticle;
+  int32_t device;
+  uint8_t index;
+
+  /* erase the comets of the previous frame and move them */
+  for(index = 0; index < WS2812A_MAX_PARTICLES; index++)
   {
-    uint8_t level_stored = (uint8_t)level_current;
-    uint32_t numb_of_steps = light_params.transition_time / WS2812A_TASK_INTERVAL;
-    if(numb_of_steps > 0)
+    pParticle = &pPool->particles[index];
+    if(!pParticle->active)
     {
-      /* at least one transitional step */
-      float level_change = (light_params.level_target - (float)level_current) / (numb_of_steps + 1.0f);
-      level_current += level_change;
-      light_params.transition_time -= WS2812A_TASK_INTERVAL;
+      continue;
     }
-    else
+    for(device = pParticle->head; device < pParticle->head + WS2812A_PARTICLE_TAIL; device++)
+    {
+      if((device >= 0) && (device < number_of_devices))
+      {
+        WS2812A_set_device(device, black);
+      }
+    }
+    /* the comet travels until its tail leaves the strip start; the distance is limited so that the head cannot wrap after a long frame gap */
+    uint64_t path = (uint64_t)(number_of_devices + WS2812A_PARTICLE_TAIL);
+    uint64_t distance = ((uint64_t)(frame_tick - pParticle->start_tick) * path) / pParticle->travel_time;
+    if(distance > path)
     {
-      /* the final level changing step */
-      level_current = light_params.level_target;
-      light_params.transition_time = 0;
+      distance = path;
     }
-
-    if((uint8_t)level_current != level_stored)
+    pParticle->head = (int16_t)((int32_t)number_of_devices - 1 - (int32_t)distance);
+    if(pParticle->head + WS2812A_PARTICLE_TAIL <= 0)
     {
-      /* transmit only if current level has been effectively changed */
-      transmit_request = true;
+      pParticle->active = false;
     }
   }
 
-  /* transmit pulses to WS2812A devices */
-  if(transmit_request)
+  /* start a new comet from a free slot of the pool */
+  uint32_t propability_ratio = pParams->density / (frame_elapsed ? frame_elapsed : 1);
+  if((propability_ratio == 0) || (WS2812A_random(propability_ratio) == 0))
   {
-    /* generate WS2812A pulses and place them in the pulse buffer */
-    size_t dev_index;
-    uint8_t* pBuffer = WS2812A_pulse_buffer;
-    uint8_t first_color, middle_color, last_color;
-    
-    /* calculate the corrected level */
-    uint8_t level_corrected = (uint8_t)(level_current * (level_current + 64.0f) / 320.0f);
-    /* the corrected level must not be 0 when the level_current != 0 */
-    if((level_current >= 1.0f) && (level_corrected < 0xFF))
+    for(index = 0; index < WS2812A_MAX_PARTICLES; index++)
     {
-      ++level_corrected;
+      pParticle = &pPool->particles[index];
+      if(!pParticle->active)
+      {
+        /* the travel time varies from 1/2 to 3/2 of the speed parameter */
+        pParticle->start_tick = frame_tick;
+        pParticle->travel_time = pParams->speed / 2 + WS2812A_random(pParams->speed + 1) + 1;
+        pParticle->head = number_of_devices - 1;
+        pParticle->color = WS2812A_palette_color(pParams->palette, WS2812A_random(0x100));
+        pParticle->active = true;
+        break;
+      }
     }
+  }
 
-    for(dev_index = 0; dev_index < WS2812A_NUMB_DEV; dev_index++)
+  /* draw the comets; overlapping comets are mixed by the brighter component */
+  for(index = 0; index < WS2812A_MAX_PARTICLES; index++)
+  {
+    pParticle = &pPool->particles[index];
+    if(!pParticle->active)
+    {
+      continue;
+    }
+    RGB_t color = pParticle->color;
+    for(device = pParticle->head; device < pParticle->head + WS2812A_PARTICLE_TAIL; device++)
     {
-#if GRB_ORDER /* GRB color order */
-  first_color = WS2812A_RGB_data[dev_index].G;
-  middle_color = WS2812A_RGB_data[dev_index].R;
-  last_color = WS2812A_RGB_data[dev_index].B;
-#else /* RGB color order */
-  first_color = WS2812A_RGB_data[dev_index].R;
-  middle_color = WS2812A_RGB_data[dev_index].G;
-  last_color = WS2812A_RGB_data[dev_index].B;
-#endif      
+      if((device >= 0) && (device < number_of_devices))
+      {
+        RGB_t current = WS2812A_get_device(device);
+        current.R = (color.R > current.R) ? color.R : current.R;
+        current.G = (color.G > current.G) ? color.G : current.G;
+        current.B = (color.B > current.B) ? color.B : current.B;
+        WS2812A_set_device(device, current);
+      }
+      color.R >>= 1;
+      color.G >>= 1;
+      color.B >>= 1;
+    }
+  }
+}
 
-      /* generate pulses for color green */
-      bits_to_pulses((first_color * level_corrected / 0xFF) & 0xFF, &pBuffer);
-      
-      /* generate pulses for color red */
-      bits_to_pulses((middle_color * level_corrected / 0xFF) & 0xFF, &pBuffer);
+/* a step of the fastest possible comet by one device */
+static uint32_t WS2812A_particles_step_time(const void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  UNUSED(pState);
+  return (pParams->speed / 2 + 1) / (number_of_devices + WS2812A_PARTICLE_TAIL);
+}
 
-      /* generate pulses for color blue */
-      bits_to_pulses((last_color * level_corrected / 0xFF) & 0xFF, &pBuffer);
-    }
+/* starts the animation asset of the effect index from its first frame */
+static void WS2812A_playback_init(void* pState, const WS2812A_EffectParams_t* pParams)
+{
+  WS2812A_PlaybackState_t* pPlayback = pState;
 
-    /* transmit data to all WS2812A devices */
-    HAL_SPI_Transmit_DMA(pWS2812A_SPI, WS2812A_pulse_buffer, WS2812A_PULSE_BUF_SIZE);
-  }
+  UNUSED(pParams);
+  pPlayback->pAsset = &WS2812A_assets[effect_running - WS2812A_NUMB_EFFECTS];
+  pPlayback->pRecord = pPlayback->pAsset->pData;
+  pPlayback->frame = 0;
+  pPlayback->next_tick = frame_tick;
 }
 
-void color_loop_cycling(float period, bool use_groups)
+/* applies the delta records of the asset frames due since the previous frame; the asset repeats from frame 0 */
+static void WS2812A_playback_render(void* pState, const WS2812A_EffectParams_t* pParams)
 {
-  static float phase0 = 0.0f;  // phase of the first device in the hue circle <0,1>
-  uint16_t group;
-  uint16_t dev_index = 0;  /* index of the device to be set */
-  float phase_delta = 0.001f * WS2812A_TASK_INTERVAL / period;
-  HS_t color_hs;
-  RGB_t color_rgb;
-  float phase;
-  float direction = (light_params.loop_direction == 0) ? 1.0f : -1.0f;
+  WS2812A_PlaybackState_t* pPlayback = pState;
+  const WS2812A_Asset_t* pAsset = pPlayback->pAsset;
+  uint16_t numb_due = pAsset->numb_frames;  /* a late frame plays at most one cycle */
 
-  phase0 += phase_delta;
-  phase0 = fmodf(phase0 + 1.0f, 1.0f);   // the phase is again in the range <0,1>
-  
-  /* set all groups */
-   for(group = 0; group < number_of_groups; group++)
+  UNUSED(pParams);
+  while(((int32_t)(frame_tick - pPlayback->next_tick) >= 0) && (numb_due-- > 0))
   {
-    uint16_t device;
-    phase = phase0;
-    if(use_groups)
-    {
-      phase += direction * (float)group / (float)number_of_groups;
-      phase = fmodf(phase + 1.0f, 1.0f);   // the phase is in the range <0,1>
-    }
-    color_hs.hue = (uint8_t)(phase * 0x100) % 0x100;
-    color_hs.sat = MAX_SAT;
-    color_rgb = convert_HS_to_RGB(color_hs);
-    /* set all devices in a group */
-    for(device = 0; device < group_size[group]; device++)
+    pPlayback->pRecord = WS2812A_play_frame(pPlayback->pRecord);
+    pPlayback->next_tick += pAsset->frame_interval;
+    if(++pPlayback->frame >= pAsset->numb_frames)
     {
-      if(dev_index < WS2812A_NUMB_DEV)
-      {
-        WS2812A_RGB_data[dev_index++] = color_rgb;
-      }
+      pPlayback->pRecord = pAsset->pData;
+      pPlayback->frame = 0;
     }
   }
+  if((int32_t)(frame_tick - pPlayback->next_tick) >= 0)
+  {
+    /* the frames skipped by a long break are not caught up */
+    pPlayback->next_tick = frame_tick + pAsset->frame_interval;
+  }
 }
 
-void color_loop_random(float period, bool use_groups)
+/* an asset frame */
+static uint32_t WS2812A_playback_step_time(const void* pState, const WS2812A_EffectParams_t* pParams)
 {
-  HS_t color_hs;
-  static RGB_t color_rgb_current = {WS2812A_RGB_WHITE, WS2812A_RGB_WHITE, WS2812A_RGB_WHITE};
-  static RGB_t color_rgb_target = {WS2812A_RGB_WHITE, WS2812A_RGB_WHITE, WS2812A_RGB_WHITE};
-  static uint16_t group_active;
-  uint16_t group_index;
-  static float remaining_time;
-  uint16_t device, group;
-  static const float Task_interval = 0.001f * WS2812A_TASK_INTERVAL;
+  const WS2812A_PlaybackState_t* pPlayback = pState;
+
+  UNUSED(pParams);
+  return pPlayback->pAsset->frame_interval;
+}
 
-  /* initialize groups if it is the first pass after the loop mode has been changed */
-  if(light_params.color_loop_mode != last_color_loop_mode)
+/* returns an unsigned LEB128 number of an asset record and moves the pointer behind it */
+static uint32_t WS2812A_read_number(const uint8_t** ppData)
+{
+  const uint8_t* pData = *ppData;
+  uint32_t number = 0;
+  uint8_t shift = 0;
+
+  do
   {
-    group_index = 0;
-    RGB_t color_rgb_init;
-    for(group = 0; group < number_of_groups; group++)
+    number |= (uint32_t)(*pData & 0x7F) << shift;
+    shift += 7;
+  } while((*pData++ & 0x80) != 0);
+  *ppData = pData;
+  return number;
+}
+
+/* sets the devices changed by the delta record of an asset frame; returns the record of the next frame */
+static const uint8_t* WS2812A_play_frame(const uint8_t* pRecord)
+{
+  uint32_t numb_runs = WS2812A_read_number(&pRecord);
+  uint32_t device = 0;
+
+  while(numb_runs-- > 0)
+  {
+    device += WS2812A_read_number(&pRecord);
+    uint32_t header = WS2812A_read_number(&pRecord);
+    uint32_t length = header >> 1;
+    if((header & 1) != 0)
     {
-      if((group == 0) || (use_groups))
+      /* one color of all devices of the run */
+      RGB_t color = { pRecord[0], pRecord[1], pRecord[2] };
+      pRecord += sizeof(RGB_t);
+      if(device < number_of_devices)
       {
-        /* set new init color */
-        color_hs.hue = rand() % 0x100;  /* random hue */
-        color_hs.sat = MAX_SAT;
-        color_rgb_init = convert_HS_to_RGB(color_hs);  
+        WS2812A_set_devices(device, (device + length <= number_of_devices) ? length : number_of_devices - device, color);
       }
-
-      for(device = 0; device < group_size[group]; device++)
+      device += length;
+    }
+    else
+    {
+      for(; length > 0; length--)
       {
-        WS2812A_RGB_data[group_index + device] = color_rgb_init;
+        if(device < number_of_devices)
+        {
+          WS2812A_set_device(device, (RGB_t){ pRecord[0], pRecord[1], pRecord[2] });
+        }
+        pRecord += sizeof(RGB_t);
+        device++;
       }
-      group_index += group_size[group];
     }
   }
+  return pRecord;
+}
 
-  /* check if the current color equals the target color */
-  if((color_rgb_current.R == color_rgb_target.R) &&
-     (color_rgb_current.G == color_rgb_target.G) &&
-     (color_rgb_current.B == color_rgb_target.B))
+/* steps the level target of the light switched on; the light stays on */
+static void WS2812A_level_step(uint8_t mode, uint8_t size, uint32_t transition_time)
+{
+  if(light_params.level_target == 0)
   {
-    /* set new active group; 0 if groups not used */
-    group_active = use_groups ? rand() % number_of_groups : 0;
-    /* set new target color */
-    color_hs.hue = rand() % 0x100;  /* random hue */
-    color_hs.sat = MAX_SAT;
-    color_rgb_target = convert_HS_to_RGB(color_hs);
-    /* set current color from acitve group data */
-    group_index = 0;
-    for(group = 0; group < group_active; group++)
-    {
-      group_index += group_size[group];
-    }
-    color_rgb_current = WS2812A_RGB_data[group_index];
-    /* reset remaining time */
-    remaining_time = period;
+    return; /* do nothing when the light is off */
   }
 
-  /* single step current color change */
-  if(remaining_time <= Task_interval)
+  if(mode == 0)
   {
-    /* transfer time elapsed */
-    color_rgb_current = color_rgb_target;
+    /* brightness up */
+    light_params.level_target = (0xFF - light_params.level_target > size) ? light_params.level_target + size : 0xFE;
   }
   else
   {
-    /* next color changing step */
-    color_rgb_current.R += (int8_t)(((float)color_rgb_target.R - (float)color_rgb_current.R) * Task_interval / remaining_time);
-    color_rgb_current.G += (int8_t)(((float)color_rgb_target.G - (float)color_rgb_current.G) * Task_interval / remaining_time);
-    color_rgb_current.B += (int8_t)(((float)color_rgb_target.B - (float)color_rgb_current.B) * Task_interval / remaining_time);
-    remaining_time -= Task_interval;
-  }
-
-  group_index = 0;
-  for(group = 0; group < number_of_groups; group++)
-  {
-    if((!use_groups) || (group == group_active))
-    {
-      for(device = 0; device < group_size[group]; device++)
-      {
-        WS2812A_RGB_data[group_index + device] = color_rgb_current;
-      }
-    }
-    group_index += group_size[group];
+    /* brightness down */
+    light_params.level_target = (light_params.level_target > size) ? light_params.level_target - size : 0x01;
   }
+  light_params.level_on = light_params.level_target;
+  light_params.transition_time = transition_time;
 }
 
-void color_loop_comet(float travel_time, float mean_interval)
+/* turns the color loop on with the next, previous or given effect */
+static void WS2812A_loop_start(int8_t effect_step, uint8_t effect, uint8_t direction)
 {
-  static float step_time = 0.001f * WS2812A_TASK_INTERVAL;    /* current step timer */
-  float step_interval = travel_time / WS2812A_NUMB_DEV;   /* nominal interval of a single step [s] */
-  uint16_t device;
+  uint8_t last_effect = WS2812A_GetNumbEffects() - 1;
 
-  step_time -= 0.001f * WS2812A_TASK_INTERVAL;
-  if(step_time <= 0.0f)
+  if(direction != WS2812A_LOOP_DIR_KEEP)
   {
-    step_time = step_interval;
-    for(device = 0; device < WS2812A_NUMB_DEV - 1; device++)
-    {
-      WS2812A_RGB_data[device] = WS2812A_RGB_data[device + 1];   
-    }
-    WS2812A_RGB_data[WS2812A_NUMB_DEV - 1].R >>= 1; 
-    WS2812A_RGB_data[WS2812A_NUMB_DEV - 1].G >>= 1;
-    WS2812A_RGB_data[WS2812A_NUMB_DEV - 1].B >>= 1;        
+    light_params.loop_direction = direction;
   }
-
-  uint16_t propability_ratio = mean_interval * 1000 / WS2812A_TASK_INTERVAL;
-  if((rand() % propability_ratio == 0) &&
-     (WS2812A_RGB_data[WS2812A_NUMB_DEV - 1].R == 0) &&
-     (WS2812A_RGB_data[WS2812A_NUMB_DEV - 1].G == 0) &&
-     (WS2812A_RGB_data[WS2812A_NUMB_DEV - 1].B == 0))
+  if(effect_step > 0)
+  {
+    light_params.effect = (light_params.effect < last_effect) ? light_params.effect + 1 : 0;
+  }
+  else if(effect_step < 0)
+  {
+    light_params.effect = (light_params.effect > 0) ? light_params.effect - 1 : last_effect;
+  }
+  else
   {
-    HS_t color_hs;
-    color_hs.hue = rand() % 0x100;  /* random hue */
-    color_hs.sat = MAX_SAT;
-    WS2812A_RGB_data[WS2812A_NUMB_DEV - 1] = convert_HS_to_RGB(color_hs);    
+    light_params.effect = effect;
   }
+  light_params.color_mode = COLOR_LOOP;
 }
 
 /**
@@ -432,10 +3065,10 @@ void color_loop_comet(float travel_time, float mean_interval)
  * @param mode  0 = increase brightness toward 0xFF; non-zero = decrease toward 0x01.
  * @param rate  Movement speed in levels per second. If 0, movement is stopped and the current level is held.
  *
- * @note If global `level_current` == 0.0, the function returns immediately (no movement while "off").
+ * @note If global `level_current` == 0, the function returns immediately (no movement while "off").
  * @sideeffects Updates global `light_params.level_target` and `light_params.transition_time` (ms).
  */
-void brightness_move(uint8_t mode, uint8_t rate)
+static void WS2812A_brightness_move(uint8_t mode, uint8_t rate)
 {
   if(level_current == 0)
   {
@@ -449,20 +3082,29 @@ void brightness_move(uint8_t mode, uint8_t rate)
     {
       //increase brightness
       light_params.level_target = 0xFF;
-      light_params.transition_time = (uint32_t)(((float)light_params.level_target - level_current) / (float)rate * 1000.0f);
     }
     else
     {
       //decrease brightness
       light_params.level_target = 0x01;
-      light_params.transition_time = (uint32_t)((level_current - (float)light_params.level_target) / (float)rate * 1000.0f);
     }
+    /* the current level may already be past the target by a fraction of a step */
+    int32_t distance = ((int32_t)light_params.level_target << 8) - (int32_t)level_current;
+    if(mode != 0)
+    {
+      distance = -distance;
+    }
+    if(distance < 0)
+    {
+      distance = 0;
+    }
+    light_params.transition_time = (uint32_t)distance * 1000 / ((uint32_t)rate << 8);
 
   }
   else
   {
     //stop moving brightness
-    light_params.level_target = (uint8_t)level_current;
+    light_params.level_target = (uint8_t)(level_current >> 8);
     light_params.transition_time = 0;
   }
 }
\ No newline at end of file
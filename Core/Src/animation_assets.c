@@ -0,0 +1,465 @@
+/* Generated by Host/Src/gen_animation_assets.c - do not edit */
+
+#include "WS2812A_driver.h"
+
+/* particles.txt: 200 frames of 60 devices every 20 ms */
+static const uint8_t asset0_data[7187] =
+{
+  0x01, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x3B, 0x02, 0xB7, 0x48, 0x00, 0x01, 0x3A, 0x04, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00,
+  0x01, 0x39, 0x06, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x00, 0x01, 0x37, 0x0A,
+  0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x00,
+  0x01, 0x35, 0x0E, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B,
+  0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x33, 0x12, 0xB7, 0x48, 0x00, 0x5B,
+  0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x32, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24,
+  0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D,
+  0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00,
+  0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x2F, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09,
+  0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x2E, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B,
+  0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2D,
+  0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00,
+  0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2C, 0x12, 0xB7,
+  0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02,
+  0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x12, 0xED, 0x00, 0x01,
+  0x2B, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04,
+  0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2A, 0x12,
+  0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05,
+  0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x12, 0xED, 0x00,
+  0xC3, 0x76, 0x00, 0x01, 0x29, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16,
+  0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x28, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00,
+  0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x06, 0x12, 0xED, 0x00, 0xC3, 0x76, 0x00, 0x61, 0x3B, 0x00, 0x02, 0x27, 0x12, 0xB7, 0x48, 0x00,
+  0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0xC3, 0x3C, 0x00, 0x61, 0xED, 0x00,
+  0x30, 0x76, 0x00, 0x18, 0x3B, 0x00, 0x02, 0x26, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D,
+  0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x08, 0xC3, 0xED, 0x00, 0x61, 0x76, 0x00, 0x30, 0x3B, 0x00, 0x18,
+  0x1D, 0x00, 0x02, 0x25, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09,
+  0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x0C, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0xED, 0x00, 0x18, 0x76, 0x00, 0x0C, 0x3B,
+  0x00, 0x06, 0x1D, 0x00, 0x02, 0x24, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00,
+  0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x0E, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0xED, 0x00, 0x18, 0x76, 0x00,
+  0x0C, 0x3B, 0x00, 0x06, 0x1D, 0x00, 0x03, 0x0E, 0x00, 0x02, 0x23, 0x12, 0xB7, 0x48, 0x00, 0x5B,
+  0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30,
+  0x0F, 0x00, 0x18, 0xED, 0x00, 0x0C, 0x76, 0x00, 0x06, 0x3B, 0x00, 0x03, 0x1D, 0x00, 0xC6, 0x0E,
+  0x39, 0x02, 0x22, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00,
+  0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0xED, 0x00, 0x0C, 0x76, 0x00,
+  0x06, 0x3B, 0x00, 0x03, 0x1D, 0x00, 0xC6, 0x0E, 0x39, 0x63, 0x07, 0x1C, 0x01, 0x32, 0x10, 0xC3,
+  0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x12, 0xED, 0x00, 0x09, 0x76,
+  0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x02, 0x20, 0x14, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00,
+  0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x16, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00,
+  0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02,
+  0x1D, 0x00, 0xC6, 0x0E, 0x39, 0x63, 0x07, 0x1C, 0x31, 0x03, 0x0E, 0x02, 0x30, 0x0A, 0xC3, 0x3C,
+  0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x03, 0x08, 0xC6,
+  0x1D, 0x39, 0x63, 0x0E, 0x1C, 0x31, 0x07, 0x0E, 0x18, 0x03, 0x07, 0x02, 0x1E, 0x14, 0xB7, 0x48,
+  0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00,
+  0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1C, 0xC3, 0x3C,
+  0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00,
+  0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0xC6, 0x1D, 0x39, 0x63, 0x0E, 0x1C, 0x31,
+  0x07, 0x0E, 0x18, 0x03, 0x07, 0x0C, 0x01, 0x03, 0x01, 0x1D, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24,
+  0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2D, 0x0E, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30,
+  0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x02, 0x0C,
+  0xC6, 0x3B, 0x39, 0x63, 0x1D, 0x1C, 0x31, 0x0E, 0x0E, 0x18, 0x07, 0x07, 0x0C, 0x03, 0x03, 0x06,
+  0x01, 0x01, 0x02, 0x1B, 0x14, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09,
+  0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0x22, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07,
+  0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x12, 0xED, 0x00,
+  0x09, 0x76, 0x00, 0xC6, 0x3B, 0x39, 0x63, 0x1D, 0x1C, 0x31, 0x0E, 0x0E, 0x18, 0x07, 0x07, 0x0C,
+  0x03, 0x03, 0x06, 0x01, 0x01, 0x03, 0x00, 0x00, 0x02, 0x2A, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E,
+  0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0xC6, 0x76, 0x39, 0x63, 0x3B, 0x1C, 0x31, 0x1D,
+  0x0E, 0x18, 0x0E, 0x07, 0x0C, 0x07, 0x03, 0x06, 0x03, 0x01, 0x03, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x02, 0x19, 0x14, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B,
+  0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x26, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C,
+  0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xED,
+  0x00, 0xC6, 0x76, 0x39, 0x63, 0x3B, 0x1C, 0x31, 0x1D, 0x0E, 0x18, 0x0E, 0x07, 0x0C, 0x07, 0x03,
+  0x06, 0x03, 0x01, 0x03, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x28, 0x12, 0xC3,
+  0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01,
+  0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x17, 0x14, 0xB7, 0x48, 0x00,
+  0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x12, 0xC3, 0x3C, 0x00,
+  0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x12, 0xED, 0x00, 0xC6, 0x76, 0x39,
+  0x63, 0x3B, 0x1C, 0x31, 0x1D, 0x0E, 0x18, 0x0E, 0x07, 0x0C, 0x07, 0x03, 0x06, 0x03, 0x01, 0x03,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x26, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E,
+  0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0xC6, 0xED, 0x39, 0x63, 0x76, 0x1C, 0x31, 0x3B,
+  0x0E, 0x18, 0x1D, 0x07, 0x0C, 0x0E, 0x03, 0x06, 0x07, 0x01, 0x03, 0x03, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x16, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16,
+  0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C,
+  0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12,
+  0x12, 0xED, 0x00, 0xC6, 0x76, 0x39, 0x63, 0x3B, 0x1C, 0x31, 0x1D, 0x0E, 0x18, 0x0E, 0x07, 0x0C,
+  0x07, 0x03, 0x06, 0x03, 0x01, 0x03, 0x01, 0x00, 0x01, 0x00, 0x00, 0x03, 0x15, 0x12, 0xB7, 0x48,
+  0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00,
+  0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x14, 0xC3, 0x3C, 0x00, 0x61, 0x1E,
+  0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0xC6, 0xED, 0x39, 0x63, 0x76,
+  0x1C, 0x31, 0x3B, 0x0E, 0x18, 0x1D, 0x07, 0x0C, 0x0E, 0x03, 0x06, 0x07, 0x01, 0x03, 0x03, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x14, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D,
+  0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0xC6, 0xED, 0x39, 0x63, 0x76, 0x1C, 0x31, 0x3B, 0x0E, 0x18,
+  0x1D, 0x07, 0x0C, 0x0E, 0x03, 0x06, 0x07, 0x01, 0x03, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x13, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00,
+  0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x14, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00,
+  0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x12, 0xC6, 0x00, 0x39, 0x63, 0xED, 0x1C, 0x31, 0x76, 0x0E, 0x18, 0x3B, 0x07, 0x0C, 0x1D, 0x03,
+  0x06, 0x0E, 0x01, 0x03, 0x07, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x03, 0x12, 0x12, 0xB7,
+  0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02,
+  0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0xC3, 0x3C, 0x00, 0x61,
+  0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 0xC6, 0x00, 0x39, 0x63, 0xED, 0x1C, 0x31,
+  0x76, 0x0E, 0x18, 0x3B, 0x07, 0x0C, 0x1D, 0x03, 0x06, 0x0E, 0x01, 0x03, 0x07, 0x00, 0x01, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00,
+  0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12,
+  0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x14, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07,
+  0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x14, 0xC6, 0x00, 0x39, 0x63, 0xED, 0x1C, 0x31, 0x76, 0x0E, 0x18, 0x3B,
+  0x07, 0x0C, 0x1D, 0x03, 0x06, 0x0E, 0x01, 0x03, 0x07, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x0F, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16,
+  0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C,
+  0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12,
+  0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0xED, 0x0E, 0x18, 0x76, 0x07, 0x0C, 0x3B, 0x03, 0x06,
+  0x1D, 0x01, 0x03, 0x0E, 0x00, 0x01, 0x07, 0x00, 0x00, 0x03, 0x00, 0x03, 0x0E, 0x12, 0xB7, 0x48,
+  0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00,
+  0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E,
+  0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x16, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0xED,
+  0x0E, 0x18, 0x76, 0x07, 0x0C, 0x3B, 0x03, 0x06, 0x1D, 0x01, 0x03, 0x0E, 0x00, 0x01, 0x07, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0D, 0x12, 0xB7, 0x48, 0x00, 0x5B,
+  0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30,
+  0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00,
+  0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00,
+  0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x12, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0xED, 0x07, 0x0C, 0x76, 0x03,
+  0x06, 0x3B, 0x01, 0x03, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x03, 0x0B, 0x12, 0xB7,
+  0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02,
+  0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0xC3, 0x3C, 0x00, 0x61,
+  0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31,
+  0x00, 0x0E, 0x18, 0xED, 0x07, 0x0C, 0x76, 0x03, 0x06, 0x3B, 0x01, 0x03, 0x1D, 0x00, 0x01, 0x0E,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x12,
+  0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05,
+  0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0xC3, 0x3C, 0x00,
+  0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x10, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C,
+  0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x12, 0xED, 0x03, 0x09, 0x76, 0x01, 0x04, 0x3B, 0x00, 0x02,
+  0x1D, 0x00, 0x03, 0x09, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09,
+  0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x14, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03,
+  0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x1A, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x12, 0xED,
+  0x03, 0x09, 0x76, 0x01, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x12, 0xB7, 0x48, 0x00, 0x5B,
+  0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30,
+  0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00,
+  0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00,
+  0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x1A, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x12, 0xED, 0x03,
+  0x09, 0x76, 0x01, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24,
+  0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F,
+  0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x0E, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00,
+  0x07, 0x0C, 0x00, 0x03, 0x12, 0xED, 0x01, 0x09, 0x76, 0x00, 0x02, 0x12, 0x12, 0xC3, 0x3C, 0x00,
+  0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x12, 0x12, 0xED, 0x03, 0x09, 0x76, 0x01,
+  0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x14, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12,
+  0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F,
+  0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x0E, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00,
+  0x07, 0x0C, 0x00, 0x03, 0x12, 0xED, 0x01, 0x09, 0x76, 0x00, 0x02, 0x10, 0x12, 0xC3, 0x3C, 0x00,
+  0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1C, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C,
+  0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x12, 0xED, 0x01, 0x09, 0x76, 0x00, 0x04,
+  0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x14, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00,
+  0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00,
+  0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x0E, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07,
+  0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x12, 0xED, 0x00, 0x02, 0x0E, 0x12, 0xC3, 0x3C, 0x00, 0x61,
+  0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1E, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31,
+  0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x12, 0xED, 0x00, 0x09, 0x76,
+  0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x12, 0xB7, 0x48, 0x00, 0x5B, 0x24, 0x00, 0x2D,
+  0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18,
+  0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x12, 0x5B, 0x24, 0x00, 0x2D, 0x12, 0x00, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00,
+  0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x14, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00,
+  0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0x1E, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03,
+  0x06, 0x00, 0x01, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01,
+  0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1E,
+  0x0E, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03,
+  0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x0E, 0x16, 0x09, 0x00, 0x0B, 0x04, 0x00, 0x05,
+  0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x14,
+  0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06,
+  0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x20,
+  0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06,
+  0x00, 0x01, 0x03, 0x00, 0x00, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D,
+  0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x08, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C,
+  0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x0A, 0x0B, 0x04, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03,
+  0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0xC6,
+  0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00,
+  0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x08, 0x05, 0x02, 0x00, 0x02, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F,
+  0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0C, 0x22, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00,
+  0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x12, 0xED, 0x00,
+  0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x02, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18,
+  0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0C, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C,
+  0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30,
+  0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x24, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18,
+  0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x02, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00,
+  0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x01, 0x14, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03,
+  0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0D, 0x24, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00,
+  0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xED, 0x00,
+  0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x17, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00,
+  0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x12, 0xC3, 0x3C, 0x00, 0x61, 0x1E, 0x00, 0x30,
+  0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02,
+  0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x10, 0x30, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x14, 0xC6, 0x00,
+  0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x18,
+  0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x19, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01,
+  0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x0A, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00,
+  0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08,
+  0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x12, 0xC6, 0x00,
+  0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76,
+  0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x12, 0xC6, 0x00, 0x39,
+  0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00,
+  0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x12, 0xC6, 0x00, 0x39,
+  0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00,
+  0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B,
+  0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x0F, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18,
+  0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x1B, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00,
+  0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x0E, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00,
+  0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0D, 0x12,
+  0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06,
+  0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x12, 0x12, 0xED, 0x00,
+  0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00,
+  0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02, 0xCC, 0x33, 0x00, 0x02, 0x19, 0x12, 0x12, 0xED,
+  0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0xCC, 0x33, 0x00, 0x66, 0x19,
+  0x00, 0x02, 0x0B, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07,
+  0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+  0x08, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x03, 0x0A, 0x12,
+  0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06,
+  0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x12, 0xED, 0x00,
+  0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0A, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00,
+  0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x00, 0x03, 0x08, 0x14, 0xC6, 0x00, 0x39,
+  0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x12, 0xED, 0x00,
+  0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0E, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00,
+  0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01,
+  0x34, 0x10, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03,
+  0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x07, 0x12, 0xC6, 0x00, 0x39,
+  0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00,
+  0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x14, 0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00,
+  0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x06, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00,
+  0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03,
+  0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x12,
+  0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06,
+  0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x12, 0xC6, 0x00,
+  0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76,
+  0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x11, 0x14, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C,
+  0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31,
+  0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E,
+  0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00,
+  0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x14, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00,
+  0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x02, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00,
+  0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0xCC,
+  0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01,
+  0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x12, 0x12, 0xED, 0x00,
+  0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00,
+  0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00,
+  0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x20, 0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06,
+  0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x12, 0xC6, 0x00, 0x39, 0x63, 0x00, 0x1C, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C,
+  0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x12,
+  0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x12, 0xCC, 0x33, 0x00,
+  0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x63, 0x00, 0x1C, 0x31, 0x00,
+  0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0x14, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06,
+  0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x11, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02,
+  0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x0E, 0x31, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x01,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x14, 0xCC, 0x33, 0x00, 0x66, 0x19,
+  0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x18, 0x00, 0x07, 0x0C,
+  0x00, 0x03, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x12,
+  0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x12, 0xCC, 0x33, 0x00,
+  0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0A, 0x0C, 0x00, 0x03, 0x06, 0x00,
+  0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x12, 0xCC, 0x33, 0x00, 0x66,
+  0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B,
+  0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06,
+  0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x21, 0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C,
+  0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x06, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x12, 0x12, 0xED, 0x00, 0x09,
+  0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33,
+  0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x1E, 0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C,
+  0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02,
+  0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x14, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C,
+  0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x1B, 0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00,
+  0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x0C, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0xCC,
+  0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01,
+  0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0x12, 0xCC, 0x33, 0x00,
+  0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0B, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76,
+  0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C,
+  0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00,
+  0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00,
+  0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x14, 0x14, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06,
+  0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x09, 0x12, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02,
+  0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C,
+  0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12,
+  0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00,
+  0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x24, 0x12,
+  0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00,
+  0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C,
+  0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x07, 0x22, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00, 0x02,
+  0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0xCC, 0x33,
+  0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0E, 0x12, 0xCC, 0x33, 0x00, 0x66,
+  0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x20, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00,
+  0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x07, 0x00, 0xCC, 0x33, 0x00, 0x66,
+  0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x12, 0xCC, 0x33, 0x00,
+  0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x1C, 0x12, 0xED, 0x00, 0x09,
+  0x76, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x1D, 0x00, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C,
+  0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x12, 0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33,
+  0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x18, 0x12, 0xED, 0x00, 0x09, 0x76, 0x00, 0x04, 0x3B, 0x00,
+  0xCC, 0x33, 0x00, 0x66, 0x19, 0x00, 0x33, 0x0C, 0x00, 0x19, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x06,
+  0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x12, 0xCC, 0x3B,
+  0x00, 0x66, 0x1D, 0x00, 0x33, 0x0E, 0x00, 0x19, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x06, 0x01, 0x00,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x16, 0x12, 0xED, 0x00, 0xCC,
+  0x76, 0x00, 0x66, 0x3B, 0x00, 0x33, 0x1D, 0x00, 0x19, 0x0E, 0x00, 0x0C, 0x07, 0x00, 0x06, 0x03,
+  0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x12,
+  0xCC, 0xED, 0x00, 0x66, 0x76, 0x00, 0x33, 0x3B, 0x00, 0x19, 0x1D, 0x00, 0x0C, 0x0E, 0x00, 0x06,
+  0x07, 0x00, 0x03, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x12, 0xCC, 0xED,
+  0x00, 0x66, 0x76, 0x00, 0x33, 0x3B, 0x00, 0x19, 0x1D, 0x00, 0x0C, 0x0E, 0x00, 0x06, 0x07, 0x00,
+  0x03, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x12, 0xCC, 0x33, 0x00, 0x66,
+  0xED, 0x00, 0x33, 0x76, 0x00, 0x19, 0x3B, 0x00, 0x0C, 0x1D, 0x00, 0x06, 0x0E, 0x00, 0x03, 0x07,
+  0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x14, 0xCC, 0x33, 0x00, 0x66, 0xED, 0x00,
+  0x33, 0x76, 0x00, 0x19, 0x3B, 0x00, 0x0C, 0x1D, 0x00, 0x06, 0x0E, 0x00, 0x03, 0x07, 0x00, 0x01,
+  0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x66, 0x19, 0x00, 0x33, 0xED,
+  0x00, 0x19, 0x76, 0x00, 0x0C, 0x3B, 0x00, 0x06, 0x1D, 0x00, 0x03, 0x0E, 0x00, 0x01, 0x07, 0x00,
+  0x00, 0x03, 0x00
+};
+
+/* assets played by the effects following the effect registry */
+const WS2812A_Asset_t WS2812A_assets[] =
+{
+  { asset0_data, sizeof(asset0_data), 60, 200, 20 }
+};
+const uint8_t WS2812A_numb_assets = sizeof(WS2812A_assets) / sizeof(WS2812A_assets[0]);
@@ -0,0 +1,207 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    animator.c
+  * @author  Marcin Slawicz
+  * @brief   time-based animation of light parameters
+  ******************************************************************************
+  * @attention
+  *
+  * Every channel holds its value in Q16.16 format. A transition runs from the
+  * value at its start time linearly by the given change over the given duration;
+  * a move changes the value at a constant rate until stopped.
+  * All channels are evaluated in one pass per frame from the elapsed time, so
+  * a late frame does not slow down a transition. A transition, move or stop
+  * starts from the value of the last frame. A move advances its start to every
+  * evaluated frame, so it may run indefinitely.
+  * The functions are called from the sequencer tasks only.
+  *
+  ******************************************************************************
+  */
+
+#include "animator.h"
+
+typedef struct
+{
+  uint32_t value;       /* current value in Q16.16 format; wraps around modulo 2^32 */
+  uint32_t start;       /* value at the start time; the value of the last frame of a move */
+  int64_t change;       /* change over the whole transition, or per second of a move */
+  int64_t remainder;    /* fraction of a move not added to the value yet [1/1000 of the Q16.16 unit] */
+  uint32_t start_time;  /* tick of the start [ms]; the tick of the last frame of a move */
+  uint32_t duration;    /* transition duration [ms]; 0 = move */
+  uint32_t inv_duration;    /* 2^32 / duration */
+  bool active;
+} ANIM_Channel_t;
+
+static ANIM_Channel_t ANIM_channels[ANIM_NUMB_CHANNELS];
+
+static inline void ANIM_evaluate(ANIM_Channel_t* pChannel, uint32_t now);
+
+/* sets the value of the channel and stops its animation */
+void ANIM_Set(ANIM_ChannelTypeDef channel, uint32_t value)
+{
+  ANIM_channels[channel].value = value;
+  ANIM_channels[channel].active = false;
+}
+
+/**
+ * @brief Start a transition of the channel from its current value.
+ *
+ * @param channel   Animated channel.
+ * @param change    Change of the value in Q16.16 format; a wrapping channel may change by more than its range.
+ * @param duration  Transition time [ms]; 0 sets the final value at once.
+ * @param now       Current tick [ms].
+ */
+void ANIM_Start(ANIM_ChannelTypeDef channel, int64_t change, uint32_t duration, uint32_t now)
+{
+  ANIM_Channel_t* pChannel = &ANIM_channels[channel];
+
+  pChannel->start = pChannel->value;
+  pChannel->change = change;
+  pChannel->start_time = now;
+  if(duration == 0)
+  {
+    pChannel->value = pChannel->start + (uint32_t)change;
+    pChannel->active = false;
+  }
+  else
+  {
+    pChannel->duration = duration;
+    pChannel->inv_duration = (uint32_t)(0x100000000ULL / duration);
+    pChannel->active = true;
+  }
+}
+
+/**
+ * @brief Start a continuous move of the channel from its current value.
+ *
+ * @param channel   Animated channel.
+ * @param rate      Change of the value per second in Q16.16 format; 0 stops the channel.
+ * @param now       Current tick [ms].
+ */
+void ANIM_Move(ANIM_ChannelTypeDef channel, int64_t rate, uint32_t now)
+{
+  ANIM_Channel_t* pChannel = &ANIM_channels[channel];
+
+  pChannel->start = pChannel->value;
+  pChannel->change = rate;
+  pChannel->remainder = 0;
+  pChannel->start_time = now;
+  pChannel->duration = 0;
+  pChannel->active = (rate != 0);
+}
+
+/* stops the channel at its value of the last frame */
+void ANIM_Stop(ANIM_ChannelTypeDef channel)
+{
+  ANIM_channels[channel].active = false;
+}
+
+/**
+ * @brief Advance all channels to the given moment.
+ *
+ * @param now  Current tick [ms].
+ * @return Mask of the channels whose value has been changed in this pass.
+ */
+uint32_t ANIM_Update(uint32_t now)
+{
+  uint32_t animated = 0;
+  uint8_t channel;
+
+  for(channel = 0; channel < ANIM_NUMB_CHANNELS; channel++)
+  {
+    if(ANIM_channels[channel].active)
+    {
+      ANIM_evaluate(&ANIM_channels[channel], now);
+      animated |= ANIM_MASK(channel);
+    }
+  }
+
+  return animated;
+}
+
+/* returns the value of the channel at the last update in Q16.16 format */
+uint32_t ANIM_Value(ANIM_ChannelTypeDef channel)
+{
+  return ANIM_channels[channel].value;
+}
+
+/* returns the final value of the running transition or the current value */
+uint32_t ANIM_Target(ANIM_ChannelTypeDef channel)
+{
+  const ANIM_Channel_t* pChannel = &ANIM_channels[channel];
+  return (pChannel->active && (pChannel->duration != 0)) ? pChannel->start + (uint32_t)pChannel->change : pChannel->value;
+}
+
+/* returns true if the channel is in a transition or move */
+bool ANIM_Active(ANIM_ChannelTypeDef channel)
+{
+  return ANIM_channels[channel].active;
+}
+
+/* returns the remaining time of the transition [ms]; 0 for a move */
+uint32_t ANIM_Remaining(ANIM_ChannelTypeDef channel, uint32_t now)
+{
+  const ANIM_Channel_t* pChannel = &ANIM_channels[channel];
+  uint32_t elapsed = now - pChannel->start_time;
+  if(!pChannel->active || (pChannel->duration == 0) || (elapsed >= pChannel->duration))
+  {
+    return 0;
+  }
+  return pChannel->duration - elapsed;
+}
+
+/**
+ * @brief Get the time in which the channel changes by the step.
+ *
+ * @param channel   Animated channel.
+ * @param step      Change of the value in Q16.16 format.
+ * @return Time [ms] at the rate of a transition or a move; UINT32_MAX if the channel is not active.
+ */
+uint32_t ANIM_StepTime(ANIM_ChannelTypeDef channel, uint32_t step)
+{
+  const ANIM_Channel_t* pChannel = &ANIM_channels[channel];
+  uint64_t change = (pChannel->change < 0) ? (uint64_t)(-pChannel->change) : (uint64_t)pChannel->change;
+  uint64_t step_time;
+
+  if(!pChannel->active || (change == 0))
+  {
+    return UINT32_MAX;
+  }
+  if(pChannel->duration == 0)
+  {
+    step_time = (uint64_t)step * 1000 / change;
+  }
+  else
+  {
+    step_time = (uint64_t)step * pChannel->duration / change;
+  }
+
+  return (step_time > UINT32_MAX) ? UINT32_MAX : (uint32_t)step_time;
+}
+
+/* computes the value of the active channel at the given moment; the transition ends at its final value */
+static inline void ANIM_evaluate(ANIM_Channel_t* pChannel, uint32_t now)
+{
+  uint32_t elapsed = now - pChannel->start_time;
+  if(pChannel->duration == 0)
+  {
+    /* continuous move; the whole seconds wrap modulo 2^32 like the value, the rest keeps its fraction */
+    int64_t fraction = pChannel->change * (elapsed % 1000) + pChannel->remainder;
+    pChannel->value = pChannel->start + (uint32_t)pChannel->change * (elapsed / 1000) + (uint32_t)(fraction / 1000);
+    pChannel->remainder = fraction % 1000;
+    pChannel->start = pChannel->value;
+    pChannel->start_time = now;
+    return;
+  }
+
+  if(elapsed >= pChannel->duration)
+  {
+    pChannel->value = pChannel->start + (uint32_t)pChannel->change;
+    pChannel->active = false;
+    return;
+  }
+
+  uint32_t progress = (uint32_t)(((uint64_t)elapsed * pChannel->inv_duration) >> 16);
+  pChannel->value = pChannel->start + (uint32_t)((pChannel->change * progress) >> 16);
+}
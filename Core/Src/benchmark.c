@@ -0,0 +1,260 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    benchmark.c
+  * @author  Marcin Slawicz
+  * @brief   microbenchmarks of color conversion and frame encoding
+  ******************************************************************************
+  * @attention
+  *
+  * The same source is used on the target, where time is measured in DWT CYCCNT
+  * core clock cycles, and in the host build, where it is measured in ns.
+  * The frame benchmark requires the driver to be initialized.
+  *
+  ******************************************************************************
+  */
+
+#include "benchmark.h"
+#include "WS2812A_driver.h"
+#include "prng.h"
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef WS2812A_HOST_BUILD
+#include <time.h>
+#endif
+
+static volatile uint32_t bench_sink;    /* keeps the results of benchmarked functions alive */
+
+static void bench_start_timer(void);
+static inline uint64_t bench_time(void);
+static void bits_to_pulses_loop(uint8_t color_value, uint8_t** ppBuffer);
+
+/**
+ * @brief Run all benchmarks.
+ *
+ * @param pResults     Array for the results.
+ * @param max_results  Size of the array.
+ * @return Number of results stored.
+ */
+uint8_t BENCH_Run(BENCH_Result_t* pResults, uint8_t max_results)
+{
+  uint8_t numb_results = 0;
+  uint32_t iteration;
+  uint64_t start;
+  uint8_t pulses[8];
+  uint8_t* pBuffer;
+
+  bench_start_timer();
+
+  /* XY to RGB over a sweep of the color gamut */
+  if(numb_results < max_results)
+  {
+    start = bench_time();
+    for(iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+      XY_t color_xy = { (uint16_t)(10000 + (iteration * 37) % 35000), (uint16_t)(10000 + (iteration * 53) % 30000) };
+      RGB_t color_rgb = convert_XY_to_RGB(color_xy);
+      bench_sink += color_rgb.R + color_rgb.G + color_rgb.B;
+    }
+    pResults[numb_results++] = (BENCH_Result_t){ "convert_XY_to_RGB", BENCH_ITERATIONS, 1, bench_time() - start };
+  }
+
+  /* HS to RGB over all hues and saturations */
+  if(numb_results < max_results)
+  {
+    start = bench_time();
+    for(iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+      HS_t color_hs = { (uint8_t)iteration, (uint8_t)(0xFF - (iteration >> 8)) };
+      RGB_t color_rgb = convert_HS_to_RGB(color_hs);
+      bench_sink += color_rgb.R + color_rgb.G + color_rgb.B;
+    }
+    pResults[numb_results++] = (BENCH_Result_t){ "convert_HS_to_RGB", BENCH_ITERATIONS, 1, bench_time() - start };
+  }
+
+  /* integer HSV kernel over the enhanced hue circle */
+  if(numb_results < max_results)
+  {
+    start = bench_time();
+    for(iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+      RGB_t color_rgb = convert_HSV_to_RGB((uint16_t)(iteration * 65), (uint8_t)(0xFE - (iteration >> 4)));
+      bench_sink += color_rgb.R + color_rgb.G + color_rgb.B;
+    }
+    pResults[numb_results++] = (BENCH_Result_t){ "convert_HSV_to_RGB", BENCH_ITERATIONS, 1, bench_time() - start };
+  }
+
+  /* color temperature to XY over the supported mireds range */
+  if(numb_results < max_results)
+  {
+    start = bench_time();
+    for(iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+      XY_t color_xy = convert_temp_to_XY((uint16_t)(100 + iteration % 351));
+      bench_sink += color_xy.X + color_xy.Y;
+    }
+    pResults[numb_results++] = (BENCH_Result_t){ "convert_temp_to_XY", BENCH_ITERATIONS, 1, bench_time() - start };
+  }
+
+  /* color temperature to RGB from the interpolated table */
+  if(numb_results < max_results)
+  {
+    start = bench_time();
+    for(iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+      RGB_t color_rgb = convert_temp_to_RGB((uint16_t)(100 + iteration % 351));
+      bench_sink += color_rgb.R + color_rgb.G + color_rgb.B;
+    }
+    pResults[numb_results++] = (BENCH_Result_t){ "convert_temp_to_RGB", BENCH_ITERATIONS, 1, bench_time() - start };
+  }
+
+  /* gamma encoding with the threshold table against the powf() reference */
+  if(numb_results < max_results)
+  {
+    start = bench_time();
+    for(iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+      bench_sink += gamma_encode(iteration * (1.0f / BENCH_ITERATIONS));
+    }
+    pResults[numb_results++] = (BENCH_Result_t){ "gamma_encode", BENCH_ITERATIONS, 1, bench_time() - start };
+  }
+
+  if(numb_results < max_results)
+  {
+    start = bench_time();
+    for(iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+      bench_sink += (uint8_t)(gamma_correction(iteration * (1.0f / BENCH_ITERATIONS)) * 255 + 0.5);
+    }
+    pResults[numb_results++] = (BENCH_Result_t){ "gamma_correction", BENCH_ITERATIONS, 1, bench_time() - start };
+  }
+
+  /* effect random numbers from a PCG stream against the newlib rand() reference */
+  if(numb_results < max_results)
+  {
+    PRNG_Stream_t stream;
+    PRNG_Seed(&stream, 0);
+    start = bench_time();
+    for(iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+      bench_sink += PRNG_Below(&stream, 0x100);
+    }
+    pResults[numb_results++] = (BENCH_Result_t){ "PRNG_Below", BENCH_ITERATIONS, 1, bench_time() - start };
+  }
+
+  if(numb_results < max_results)
+  {
+    start = bench_time();
+    for(iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+      bench_sink += rand() % 0x100;
+    }
+    pResults[numb_results++] = (BENCH_Result_t){ "rand", BENCH_ITERATIONS, 1, bench_time() - start };
+  }
+
+  /* table pulse encoder against the former bit loop */
+  if(numb_results < max_results)
+  {
+    start = bench_time();
+    for(iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+      pBuffer = pulses;
+      bits_to_pulses((uint8_t)iteration, &pBuffer);
+      bench_sink += pulses[0] + pulses[4];
+    }
+    pResults[numb_results++] = (BENCH_Result_t){ "bits_to_pulses", BENCH_ITERATIONS, 1, bench_time() - start };
+  }
+
+  if(numb_results < max_results)
+  {
+    start = bench_time();
+    for(iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+      pBuffer = pulses;
+      bits_to_pulses_loop((uint8_t)iteration, &pBuffer);
+      bench_sink += pulses[0] + pulses[4];
+    }
+    pResults[numb_results++] = (BENCH_Result_t){ "bits_to_pulses_loop", BENCH_ITERATIONS, 1, bench_time() - start };
+  }
+
+  /* full frame: every call changes the color of all devices, so the whole strip is re-encoded and sent */
+  if((numb_results < max_results) && (WS2812A_GetNumbDev() != 0))
+  {
+    Light_Params_t light_params_stored = light_params;
+    light_params.color_mode = COLOR_STATIC;
+    light_params.level_target = 0xFE;
+    light_params.transition_time = 0;
+    WS2812A_handler();
+
+    uint32_t frame_iterations = BENCH_ITERATIONS / 10 + 1;
+    start = bench_time();
+    for(iteration = 0; iteration < frame_iterations; iteration++)
+    {
+      light_params.color_rgb = (RGB_t){ (uint8_t)iteration, (uint8_t)(iteration * 3), (uint8_t)(iteration * 7) };
+      light_params.color_restore = true;
+      WS2812A_handler();
+    }
+    pResults[numb_results++] = (BENCH_Result_t){ "WS2812A_handler frame", frame_iterations, WS2812A_GetNumbDev(), bench_time() - start };
+    light_params = light_params_stored;
+  }
+
+  return numb_results;
+}
+
+#ifdef WS2812A_HOST_BUILD
+
+static void bench_start_timer(void)
+{
+}
+
+/* returns monotonic time [ns] */
+static inline uint64_t bench_time(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+#else
+
+/* enables the DWT cycle counter */
+static void bench_start_timer(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/* returns DWT cycle counter; a single benchmark must last less than 2^32 cycles */
+static inline uint64_t bench_time(void)
+{
+  return DWT->CYCCNT;
+}
+
+#endif
+
+/* reference: the former bit-by-bit generation of 8 5-bit pulses */
+static void bits_to_pulses_loop(uint8_t color_value, uint8_t** ppBuffer)
+{
+  uint64_t pulse_buffer = 0;
+  uint8_t bit_index;
+
+  for(bit_index = 0; bit_index < 8; bit_index++)
+  {
+    pulse_buffer <<= 5;
+    pulse_buffer |= ((color_value & 0x80) != 0 ? 0x1C : 0x10);
+    color_value <<= 1;
+  }
+
+  **ppBuffer = (pulse_buffer >> 32) & 0xFF;
+  (*ppBuffer)++;
+  **ppBuffer = (pulse_buffer >> 24) & 0xFF;
+  (*ppBuffer)++;
+  **ppBuffer = (pulse_buffer >> 16) & 0xFF;
+  (*ppBuffer)++;
+  **ppBuffer = (pulse_buffer >> 8) & 0xFF;
+  (*ppBuffer)++;
+  **ppBuffer = pulse_buffer & 0xFF;
+  (*ppBuffer)++;
+}
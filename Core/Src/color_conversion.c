@@ -5,7 +5,6 @@
 RGB_t convert_XY_to_RGB(XY_t color_xy)
 {
 #define constrain_from_0(x)		if(x < 0) { x = 0.0; }
-	float gamma_correction(float  vat2correct);
 
     RGB_t color_rgb;
 
@@ -48,15 +47,10 @@ RGB_t convert_XY_to_RGB(XY_t color_xy)
 	constrain_from_0(g)
 	constrain_from_0(b)
 
-	/* apply gamma correction */
-	r = gamma_correction(r);
-	g = gamma_correction(g);
-	b = gamma_correction(b);
-
-	/* normalize to 0..255 */
-	color_rgb.R = (uint8_t)(r * 255 + 0.5);
-	color_rgb.G = (uint8_t)(g * 255 + 0.5);
-	color_rgb.B = (uint8_t)(b * 255 + 0.5);
+	/* apply gamma correction and normalize to 0..255 */
+	color_rgb.R = gamma_encode(r);
+	color_rgb.G = gamma_encode(g);
+	color_rgb.B = gamma_encode(b);
 
     return color_rgb;
 }
@@ -72,6 +66,21 @@ float gamma_correction(float val2correct)
 	return 1.055 * powf(val2correct, 0.416666) - 0.055;
 }
 
+//apply gamma correction to a linear value <0,1> and normalize to 0..255
+//the same as (uint8_t)(gamma_correction(linear) * 255 + 0.5) using a binary search of the encoding thresholds
+uint8_t gamma_encode(float linear)
+{
+	uint8_t encoded = 0;
+	uint8_t step;
+
+	for(step = 0x80; step != 0; step >>= 1)
+	{
+		encoded += (linear >= gamma_threshold[encoded + step]) ? step : 0;	//no branch to mispredict
+	}
+
+	return encoded;
+}
+
 //convert color data from HS space to RGB value
 RGB_t convert_HS_to_RGB(HS_t color_hs)
 {
@@ -98,6 +107,51 @@ RGB_t convert_HS_to_RGB(HS_t color_hs)
     return color_rgb;
 }
 
+//convert enhanced hue <0,0xFFFF> and saturation <0,254> to RGB value at full brightness
+//integer 6-sector HSV kernel
+RGB_t convert_HSV_to_RGB(uint16_t enh_hue, uint8_t sat)
+{
+	RGB_t color_rgb;
+
+	const uint32_t position = (uint32_t)enh_hue * 6;	//position on the hue circle in Q16 format <0,6)
+	const uint8_t sector = position >> 16;
+	const uint32_t fraction = (position >> 8) & 0xFF;	//position in the sector <0,255>
+	const uint32_t saturation = (sat >= 254) ? 255 : sat;
+
+	const uint8_t p = 255 - saturation;	//the lowest component
+	const uint8_t q = 255 - (saturation * fraction + 127) / 255;	//the falling component
+	const uint8_t t = 255 - (saturation * (255 - fraction) + 127) / 255;	//the rising component
+
+	switch(sector)
+	{
+		case 0:
+		color_rgb = (RGB_t){ 255, t, p };
+		break;
+
+		case 1:
+		color_rgb = (RGB_t){ q, 255, p };
+		break;
+
+		case 2:
+		color_rgb = (RGB_t){ p, 255, t };
+		break;
+
+		case 3:
+		color_rgb = (RGB_t){ p, q, 255 };
+		break;
+
+		case 4:
+		color_rgb = (RGB_t){ t, p, 255 };
+		break;
+
+		default:
+		color_rgb = (RGB_t){ 255, p, q };
+		break;
+	}
+
+	return color_rgb;
+}
+
 //convert color temperature in mireds to Ikea light bulb color XY ( CIE 1931 colorspace )
 XY_t convert_temp_to_XY(uint16_t color_temp)
 {
@@ -105,4 +159,33 @@ XY_t convert_temp_to_XY(uint16_t color_temp)
 	color_xy.X = (uint16_t)(-0.0333105f * color_temp * color_temp + 75.92069f * color_temp + 10641.276f);
 	color_xy.Y = (uint16_t)(-0.0862128f * color_temp * color_temp + 66.42181f * color_temp + 12830.694f);
 	return color_xy;
-}
\ No newline at end of file
+}
+
+//convert color temperature in mireds to RGB value using the precomputed table with linear interpolation
+RGB_t convert_temp_to_RGB(uint16_t color_temp)
+{
+	RGB_t color_rgb;
+
+	if(color_temp <= COLOR_TEMP_MIN)
+	{
+		return color_temp_LUT[0];
+	}
+	if(color_temp >= COLOR_TEMP_MAX)
+	{
+		return color_temp_LUT[COLOR_TEMP_LUT_SIZE - 1];
+	}
+
+	const uint16_t idx = (color_temp - COLOR_TEMP_MIN) / COLOR_TEMP_LUT_STEP;
+	const uint16_t weight = (color_temp - COLOR_TEMP_MIN) % COLOR_TEMP_LUT_STEP;	//weight of the next entry <0,COLOR_TEMP_LUT_STEP-1>
+	const RGB_t* pNode = &color_temp_LUT[idx];
+
+	if(weight == 0)
+	{
+		return *pNode;
+	}
+
+	color_rgb.R = (pNode[0].R * (COLOR_TEMP_LUT_STEP - weight) + pNode[1].R * weight + COLOR_TEMP_LUT_STEP / 2) / COLOR_TEMP_LUT_STEP;
+	color_rgb.G = (pNode[0].G * (COLOR_TEMP_LUT_STEP - weight) + pNode[1].G * weight + COLOR_TEMP_LUT_STEP / 2) / COLOR_TEMP_LUT_STEP;
+	color_rgb.B = (pNode[0].B * (COLOR_TEMP_LUT_STEP - weight) + pNode[1].B * weight + COLOR_TEMP_LUT_STEP / 2) / COLOR_TEMP_LUT_STEP;
+	return color_rgb;
+}
@@ -0,0 +1,79 @@
+/* Generated by Host/Src/gen_color_temp_lut.c - do not edit */
+
+#include "color_conversion.h"
+
+/* RGB color every 5 mireds from 100 to 450 mireds */
+const RGB_t color_temp_LUT[COLOR_TEMP_LUT_SIZE] =
+{
+  {0xC5, 0xD8, 0xFF},  /* 100 */
+  {0xCA, 0xDA, 0xFF},  /* 105 */
+  {0xD0, 0xDD, 0xFF},  /* 110 */
+  {0xD5, 0xE0, 0xFF},  /* 115 */
+  {0xDB, 0xE3, 0xFF},  /* 120 */
+  {0xE0, 0xE6, 0xFF},  /* 125 */
+  {0xE6, 0xE9, 0xFF},  /* 130 */
+  {0xEC, 0xEC, 0xFF},  /* 135 */
+  {0xF1, 0xEF, 0xFF},  /* 140 */
+  {0xF7, 0xF2, 0xFF},  /* 145 */
+  {0xFD, 0xF5, 0xFF},  /* 150 */
+  {0xFF, 0xF4, 0xFB},  /* 155 */
+  {0xFF, 0xF2, 0xF6},  /* 160 */
+  {0xFF, 0xEF, 0xF0},  /* 165 */
+  {0xFF, 0xED, 0xEB},  /* 170 */
+  {0xFF, 0xEB, 0xE6},  /* 175 */
+  {0xFF, 0xE9, 0xE1},  /* 180 */
+  {0xFF, 0xE7, 0xDC},  /* 185 */
+  {0xFF, 0xE5, 0xD7},  /* 190 */
+  {0xFF, 0xE3, 0xD2},  /* 195 */
+  {0xFF, 0xE1, 0xCE},  /* 200 */
+  {0xFF, 0xDF, 0xC9},  /* 205 */
+  {0xFF, 0xDD, 0xC5},  /* 210 */
+  {0xFF, 0xDB, 0xC1},  /* 215 */
+  {0xFF, 0xD9, 0xBD},  /* 220 */
+  {0xFF, 0xD7, 0xB8},  /* 225 */
+  {0xFF, 0xD5, 0xB4},  /* 230 */
+  {0xFF, 0xD4, 0xB1},  /* 235 */
+  {0xFF, 0xD2, 0xAD},  /* 240 */
+  {0xFF, 0xD0, 0xA9},  /* 245 */
+  {0xFF, 0xCF, 0xA5},  /* 250 */
+  {0xFF, 0xCD, 0xA2},  /* 255 */
+  {0xFF, 0xCB, 0x9E},  /* 260 */
+  {0xFF, 0xCA, 0x9A},  /* 265 */
+  {0xFF, 0xC8, 0x97},  /* 270 */
+  {0xFF, 0xC7, 0x93},  /* 275 */
+  {0xFF, 0xC5, 0x90},  /* 280 */
+  {0xFF, 0xC3, 0x8D},  /* 285 */
+  {0xFF, 0xC2, 0x89},  /* 290 */
+  {0xFF, 0xC0, 0x86},  /* 295 */
+  {0xFF, 0xBF, 0x83},  /* 300 */
+  {0xFF, 0xBD, 0x80},  /* 305 */
+  {0xFF, 0xBC, 0x7C},  /* 310 */
+  {0xFF, 0xBA, 0x79},  /* 315 */
+  {0xFF, 0xB9, 0x76},  /* 320 */
+  {0xFF, 0xB7, 0x73},  /* 325 */
+  {0xFF, 0xB6, 0x70},  /* 330 */
+  {0xFF, 0xB4, 0x6D},  /* 335 */
+  {0xFF, 0xB3, 0x6A},  /* 340 */
+  {0xFF, 0xB1, 0x67},  /* 345 */
+  {0xFF, 0xB0, 0x64},  /* 350 */
+  {0xFF, 0xAE, 0x61},  /* 355 */
+  {0xFF, 0xAD, 0x5E},  /* 360 */
+  {0xFF, 0xAB, 0x5B},  /* 365 */
+  {0xFF, 0xAA, 0x58},  /* 370 */
+  {0xFF, 0xA8, 0x55},  /* 375 */
+  {0xFF, 0xA7, 0x52},  /* 380 */
+  {0xFF, 0xA5, 0x4F},  /* 385 */
+  {0xFF, 0xA4, 0x4D},  /* 390 */
+  {0xFF, 0xA2, 0x4A},  /* 395 */
+  {0xFF, 0xA0, 0x47},  /* 400 */
+  {0xFF, 0x9F, 0x44},  /* 405 */
+  {0xFF, 0x9D, 0x41},  /* 410 */
+  {0xFF, 0x9C, 0x3E},  /* 415 */
+  {0xFF, 0x9A, 0x3B},  /* 420 */
+  {0xFF, 0x99, 0x38},  /* 425 */
+  {0xFF, 0x97, 0x35},  /* 430 */
+  {0xFF, 0x95, 0x32},  /* 435 */
+  {0xFF, 0x94, 0x2F},  /* 440 */
+  {0xFF, 0x92, 0x2C},  /* 445 */
+  {0xFF, 0x90, 0x29}   /* 450 */
+};
@@ -0,0 +1,72 @@
+/* Generated by Host/Src/gen_gamma_lut.c - do not edit */
+
+#include "color_conversion.h"
+
+/* smallest linear value encoded to every 8-bit gamma value */
+const float gamma_threshold[256] =
+{
+  0.0f, 1.517634955e-04f, 4.552904866e-04f, 7.588174776e-04f,
+  1.062344527e-03f, 1.365871518e-03f, 1.669398393e-03f, 1.972925384e-03f,
+  2.276452491e-03f, 2.579979366e-03f, 2.883506473e-03f, 3.188271541e-03f,
+  3.509228118e-03f, 3.848280990e-03f, 4.205711186e-03f, 4.581793211e-03f,
+  4.976795521e-03f, 5.390979350e-03f, 5.824602675e-03f, 6.277919281e-03f,
+  6.751174107e-03f, 7.244611625e-03f, 7.758470252e-03f, 8.292985149e-03f,
+  8.848385885e-03f, 9.424899705e-03f, 1.002275106e-02f, 1.064216066e-02f,
+  1.128334086e-02f, 1.194650773e-02f, 1.263187174e-02f, 1.333963871e-02f,
+  1.407001540e-02f, 1.482320484e-02f, 1.559940074e-02f, 1.639880240e-02f,
+  1.722160541e-02f, 1.806799881e-02f, 1.893817447e-02f, 1.983231679e-02f,
+  2.075061761e-02f, 2.169325203e-02f, 2.266040258e-02f, 2.365224995e-02f,
+  2.466896921e-02f, 2.571073733e-02f, 2.677772567e-02f, 2.787011303e-02f,
+  2.898805775e-02f, 3.013173491e-02f, 3.130130842e-02f, 3.249694407e-02f,
+  3.371880576e-02f, 3.496705368e-02f, 3.624184802e-02f, 3.754336014e-02f,
+  3.887172788e-02f, 4.022711515e-02f, 4.160967842e-02f, 4.301957041e-02f,
+  4.445694387e-02f, 4.592194781e-02f, 4.741473123e-02f, 4.893544689e-02f,
+  5.048424006e-02f, 5.206125602e-02f, 5.366665497e-02f, 5.530055240e-02f,
+  5.696310475e-02f, 5.865445733e-02f, 6.037474424e-02f, 6.212411076e-02f,
+  6.390269846e-02f, 6.571063399e-02f, 6.754805893e-02f, 6.941511482e-02f,
+  7.131193578e-02f, 7.323864847e-02f, 7.519539446e-02f, 7.718229294e-02f,
+  7.919949293e-02f, 8.124711365e-02f, 8.332530409e-02f, 8.543415368e-02f,
+  8.757382631e-02f, 8.974442631e-02f, 9.194609523e-02f, 9.417894483e-02f,
+  9.644311666e-02f, 9.873872995e-02f, 1.010658965e-01f, 1.034247577e-01f,
+  1.058154181e-01f, 1.082380116e-01f, 1.106926501e-01f, 1.131794602e-01f,
+  1.156985611e-01f, 1.182500869e-01f, 1.208341196e-01f, 1.234507933e-01f,
+  1.261002272e-01f, 1.287825406e-01f, 1.314978451e-01f, 1.342462450e-01f,
+  1.370278746e-01f, 1.398428380e-01f, 1.426912397e-01f, 1.455732137e-01f,
+  1.484888494e-01f, 1.514382660e-01f, 1.544215828e-01f, 1.574389040e-01f,
+  1.604903638e-01f, 1.635760218e-01f, 1.666960269e-01f, 1.698504537e-01f,
+  1.730394363e-01f, 1.762630790e-01f, 1.795214713e-01f, 1.828147471e-01f,
+  1.861429960e-01f, 1.895063370e-01f, 1.929048449e-01f, 1.963386387e-01f,
+  1.998078376e-01f, 2.033125311e-01f, 2.068528086e-01f, 2.104288042e-01f,
+  2.140406072e-01f, 2.176883072e-01f, 2.213720232e-01f, 2.250918299e-01f,
+  2.288478613e-01f, 2.326402068e-01f, 2.364689410e-01f, 2.403341979e-01f,
+  2.442360520e-01f, 2.481746227e-01f, 2.521499991e-01f, 2.561622560e-01f,
+  2.602115273e-01f, 2.642978728e-01f, 2.684214413e-01f, 2.725822628e-01f,
+  2.767804861e-01f, 2.810162008e-01f, 2.852894664e-01f, 2.896004021e-01f,
+  2.939490974e-01f, 2.983357310e-01f, 3.027602136e-01f, 3.072227836e-01f,
+  3.117234707e-01f, 3.162623644e-01f, 3.208396137e-01f, 3.254552484e-01f,
+  3.301093876e-01f, 3.348021507e-01f, 3.395335674e-01f, 3.443037868e-01f,
+  3.491128385e-01f, 3.539608717e-01f, 3.588479459e-01f, 3.637741506e-01f,
+  3.687396049e-01f, 3.737443388e-01f, 3.787885010e-01f, 3.838721514e-01f,
+  3.889953494e-01f, 3.941582441e-01f, 3.993608952e-01f, 4.046033621e-01f,
+  4.098857641e-01f, 4.152081907e-01f, 4.205707014e-01f, 4.259733856e-01f,
+  4.314163625e-01f, 4.368996918e-01f, 4.424234629e-01f, 4.479878247e-01f,
+  4.535927474e-01f, 4.592383206e-01f, 4.649247229e-01f, 4.706519544e-01f,
+  4.764201343e-01f, 4.822293520e-01f, 4.880796671e-01f, 4.939711690e-01f,
+  4.999039769e-01f, 5.058781505e-01f, 5.118937492e-01f, 5.179508328e-01f,
+  5.240495801e-01f, 5.301899910e-01f, 5.363721251e-01f, 5.425961614e-01f,
+  5.488620996e-01f, 5.551700592e-01f, 5.615200996e-01f, 5.679122806e-01f,
+  5.743467808e-01f, 5.808235407e-01f, 5.873427391e-01f, 5.939044356e-01f,
+  6.005086303e-01f, 6.071555614e-01f, 6.138451695e-01f, 6.205775142e-01f,
+  6.273528337e-01f, 6.341711879e-01f, 6.410324574e-01f, 6.479368210e-01f,
+  6.548843384e-01f, 6.618751884e-01f, 6.689093709e-01f, 6.759869456e-01f,
+  6.831079721e-01f, 6.902726293e-01f, 6.974809170e-01f, 7.047328949e-01f,
+  7.120287418e-01f, 7.193683982e-01f, 7.267519832e-01f, 7.341796160e-01f,
+  7.416513562e-01f, 7.491672635e-01f, 7.567273974e-01f, 7.643318772e-01f,
+  7.719807029e-01f, 7.796740532e-01f, 7.874118686e-01f, 7.951943278e-01f,
+  8.030214906e-01f, 8.108934164e-01f, 8.188101649e-01f, 8.267717957e-01f,
+  8.347784281e-01f, 8.428301215e-01f, 8.509268761e-01f, 8.590690494e-01f,
+  8.672562838e-01f, 8.754888773e-01f, 8.837668896e-01f, 8.920903206e-01f,
+  9.004593492e-01f, 9.088740349e-01f, 9.173343778e-01f, 9.258404374e-01f,
+  9.343923926e-01f, 9.429902434e-01f, 9.516340494e-01f, 9.603238702e-01f,
+  9.690598845e-01f, 9.778420329e-01f, 9.866704345e-01f, 9.955451488e-01f
+};
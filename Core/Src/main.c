@@ -22,6 +22,11 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "WS2812A_driver.h"
+#include "prng.h"
+#ifdef WS2812A_BENCHMARK
+#include "benchmark.h"
+#include <stdio.h>
+#endif
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -116,7 +121,15 @@ int main(void)
   MX_RTC_Init();
   MX_SPI1_Init();
   /* USER CODE BEGIN 2 */
-  WS2812A_Init(&hspi1);
+  PRNG_Init(PRNG_HwSeed());
+  static const WS2812A_StripConfig_t strip_config[] =
+  {
+    { .phSPI = &hspi1, .numb_dev = 100, .color_order = WS2812A_ORDER_RGB, .streaming = false, .encoding = WS2812A_ENCODING_5BIT }
+  };
+  if(!WS2812A_Init(strip_config, sizeof(strip_config) / sizeof(strip_config[0])))
+  {
+    Error_Handler();
+  }
   /* USER CODE END 2 */
 
   /* Init code for STM32_WPAN */
@@ -124,6 +137,20 @@ int main(void)
 
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
+#ifdef WS2812A_BENCHMARK
+  /* the trace UART is initialized in MX_APPE_Init() */
+  BENCH_Result_t bench_results[BENCH_MAX_RESULTS];
+  uint8_t numb_bench_results = BENCH_Run(bench_results, BENCH_MAX_RESULTS);
+  for(uint8_t index = 0; index < numb_bench_results; index++)
+  {
+    printf("%s: %lu calls, %lu " BENCH_UNIT "/call, %lu " BENCH_UNIT "/item\r\n", bench_results[index].name,
+           (unsigned long)bench_results[index].iterations,
+           (unsigned long)(bench_results[index].total / bench_results[index].iterations),
+           (unsigned long)(bench_results[index].total / bench_results[index].iterations / bench_results[index].items));
+  }
+#endif
+  /* the frame clock uses the timer server initialized in MX_APPE_Init() */
+  WS2812A_StartClock();
   while (1)
   {
     /* USER CODE END WHILE */
@@ -0,0 +1,145 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    prng.c
+  * @author  Marcin Slawicz
+  * @brief   seedable pseudo-random number generator service
+  ******************************************************************************
+  * @attention
+  *
+  * PCG32 (XSH RR) streams replace newlib rand() in the frame path: no
+  * reentrancy state, a few cycles per number and independent sequences per
+  * stream. The boot seed comes from the RNG peripheral on the target and is
+  * fixed (PRNG_HOST_SEED) in the host build.
+  *
+  ******************************************************************************
+  */
+
+#include "prng.h"
+#include <stdbool.h>
+#ifndef WS2812A_HOST_BUILD
+#include "app_conf.h"
+#include "stm32wbxx_ll_bus.h"
+#include "stm32wbxx_ll_hsem.h"
+#include "stm32wbxx_ll_rcc.h"
+#include "stm32wbxx_ll_rng.h"
+#endif
+
+#define PRNG_MULTIPLIER  6364136223846793005ULL
+#define PRNG_COMMON_STREAM  0xFFFFFFFFUL   /* id of the common stream */
+
+static uint64_t PRNG_seed = PRNG_HOST_SEED;  /* seed of all streams */
+static PRNG_Stream_t PRNG_common = { .inc = 0 };  /* stream of PRNG_Random() */
+
+/**
+ * @brief Read a 64-bit seed from the RNG peripheral.
+ *
+ * @return Hardware random seed on the target; PRNG_HOST_SEED in the host build.
+ *
+ * @note The RNG is shared with CPU2; it is used under the CFG_HW_RNG_SEMID semaphore,
+ *       which also covers the CLK48 (HSI48) clock of the RNG.
+ */
+uint64_t PRNG_HwSeed(void)
+{
+#ifdef WS2812A_HOST_BUILD
+  return PRNG_HOST_SEED;
+#else
+  uint64_t seed = 0;
+  uint8_t word = 0;
+  bool hsi48_enabled;
+
+  while(LL_HSEM_1StepLock(HSEM, CFG_HW_RNG_SEMID));
+
+  hsi48_enabled = LL_RCC_HSI48_IsReady();
+  if(!hsi48_enabled)
+  {
+    LL_RCC_HSI48_Enable();
+    while(!LL_RCC_HSI48_IsReady());
+  }
+  LL_AHB3_GRP1_EnableClock(LL_AHB3_GRP1_PERIPH_RNG);
+  LL_RNG_Enable(RNG);
+
+  while(word < 2)
+  {
+    if(LL_RNG_IsActiveFlag_SECS(RNG) || LL_RNG_IsActiveFlag_SEIS(RNG))
+    {
+      /* seed error: restart the generator */
+      LL_RNG_ClearFlag_SEIS(RNG);
+      LL_RNG_Disable(RNG);
+      LL_RNG_Enable(RNG);
+    }
+    else if(LL_RNG_IsActiveFlag_DRDY(RNG))
+    {
+      seed = (seed << 32) | LL_RNG_ReadRandData32(RNG);
+      word++;
+    }
+  }
+
+  LL_RNG_Disable(RNG);
+  LL_AHB3_GRP1_DisableClock(LL_AHB3_GRP1_PERIPH_RNG);
+  if(!hsi48_enabled)
+  {
+    LL_RCC_HSI48_Disable();
+  }
+  LL_HSEM_ReleaseLock(HSEM, CFG_HW_RNG_SEMID, 0);
+
+  return seed;
+#endif
+}
+
+/* sets the seed of the streams seeded afterwards */
+void PRNG_Init(uint64_t seed)
+{
+  PRNG_seed = seed;
+  PRNG_common.inc = 0;
+}
+
+/**
+ * @brief Seed the stream.
+ *
+ * @param pStream    Stream to be seeded.
+ * @param stream_id  Identifier of the stream; streams with different ids give independent sequences.
+ */
+void PRNG_Seed(PRNG_Stream_t* pStream, uint32_t stream_id)
+{
+  pStream->state = 0;
+  pStream->inc = ((uint64_t)stream_id << 1) | 1;
+  PRNG_Next(pStream);
+  pStream->state += PRNG_seed;
+  PRNG_Next(pStream);
+}
+
+/* returns the next 32-bit number of the stream */
+uint32_t PRNG_Next(PRNG_Stream_t* pStream)
+{
+  uint64_t state = pStream->state;
+  pStream->state = state * PRNG_MULTIPLIER + pStream->inc;
+  uint32_t xorshifted = (uint32_t)(((state >> 18) ^ state) >> 27);
+  uint32_t rotation = (uint32_t)(state >> 59);
+  return (xorshifted >> rotation) | (xorshifted << ((-rotation) & 31));
+}
+
+/* returns a number <0,bound) of the stream; the multiply-shift reduction avoids the division of the modulo */
+uint32_t PRNG_Below(PRNG_Stream_t* pStream, uint32_t bound)
+{
+  return (uint32_t)(((uint64_t)PRNG_Next(pStream) * bound) >> 32);
+}
+
+/* fills the buffer with the next numbers of the stream */
+void PRNG_Fill(PRNG_Stream_t* pStream, uint32_t* pBuffer, size_t count)
+{
+  while(count--)
+  {
+    *pBuffer++ = PRNG_Next(pStream);
+  }
+}
+
+/* returns a number <0,bound) of the common stream used outside the frame task */
+uint32_t PRNG_Random(uint32_t bound)
+{
+  if(PRNG_common.inc == 0)
+  {
+    PRNG_Seed(&PRNG_common, PRNG_COMMON_STREAM);
+  }
+  return PRNG_Below(&PRNG_common, bound);
+}
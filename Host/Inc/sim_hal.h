@@ -0,0 +1,38 @@
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SIM_HAL_H
+#define SIM_HAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32wbxx_hal.h"
+#include <stdio.h>
+
+#define SIM_NUMB_SPI    4           /* number of simulated SPI peripherals */
+#define SIM_PCLK_FREQ   64000000UL  /* default simulated SPI kernel clock [Hz] */
+
+typedef struct
+{
+  uint32_t task_calls;      /* number of sequencer task calls */
+  uint64_t task_time_ns;    /* total time spent in sequencer tasks [ns] */
+  uint64_t task_time_max_ns;    /* longest sequencer task call [ns] */
+  uint32_t frames_out;      /* number of frames decoded from SPI output */
+} Sim_Stats_t;
+
+extern SPI_HandleTypeDef sim_spi[SIM_NUMB_SPI];
+extern DMA_HandleTypeDef sim_dma[SIM_NUMB_SPI];    /* TX DMA channels of the SPIs */
+extern TIM_HandleTypeDef sim_tim;   /* timer with update DMA writing the GPIO port sim_gpio */
+extern GPIO_TypeDef sim_gpio;
+extern uint32_t sim_pclk_freq;      /* simulated SPI kernel clock [Hz]; SIM_PCLK_FREQ after sim_hal_init() */
+
+void sim_hal_init(FILE* pFrameOutput);
+void sim_hal_tick(void);
+void sim_hal_run_tasks(void);
+const Sim_Stats_t* sim_hal_get_stats(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*SIM_HAL_H */
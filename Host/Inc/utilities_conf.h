@@ -0,0 +1,32 @@
+/**
+  ******************************************************************************
+  * @file    utilities_conf.h
+  * @brief   host build replacement of Core/Inc/utilities_conf.h
+  ******************************************************************************
+  * @attention
+  *
+  * The simulation runs in a single thread and serves SPI DMA callbacks
+  * from its main loop, so critical sections need no interrupt masking.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef UTILITIES_CONF_H
+#define UTILITIES_CONF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+
+#define UTILS_ENTER_CRITICAL_SECTION( )
+#define UTILS_EXIT_CRITICAL_SECTION( )
+#define UTILS_MEMSET8( dest, value, size )      memset( dest, value, size);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*UTILITIES_CONF_H */
@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * @file    bench_main.c
+  * @brief   host runner of the light engine microbenchmarks
+  ******************************************************************************
+  * @attention
+  *
+  * usage: ZB_strip_bench [-n devices] [-b baseline_file [-t tolerance_%]] [-w baseline_file]
+  *
+  * Prints the time per call and per item of every benchmark.
+  * With -b the results are compared with a baseline written before by -w;
+  * the exit status is nonzero if any result is slower than the baseline
+  * by more than the tolerance (default 50%).
+  *
+  ******************************************************************************
+  */
+
+#include "sim_hal.h"
+#include "benchmark.h"
+#include "WS2812A_driver.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static double bench_per_item(const BENCH_Result_t* pResult);
+
+int main(int argc, char* argv[])
+{
+  uint16_t numb_dev = 300;
+  const char* pBaselineName = NULL;
+  const char* pWriteName = NULL;
+  double tolerance = 50.0;
+  int option;
+
+  while((option = getopt(argc, argv, "n:b:t:w:")) != -1)
+  {
+    switch(option)
+    {
+      case 'n':
+      numb_dev = (uint16_t)atoi(optarg);
+      break;
+
+      case 'b':
+      pBaselineName = optarg;
+      break;
+
+      case 't':
+      tolerance = atof(optarg);
+      break;
+
+      case 'w':
+      pWriteName = optarg;
+      break;
+
+      default:
+      fprintf(stderr, "usage: %s [-n devices] [-b baseline_file [-t tolerance_%%]] [-w baseline_file]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  sim_hal_init(NULL);
+  srand(1);
+
+  WS2812A_StripConfig_t strip_config = { .phSPI = &sim_spi[0], .numb_dev = numb_dev, .color_order = WS2812A_ORDER_RGB, .streaming = false,
+                                         .encoding = WS2812A_ENCODING_5BIT };
+  if(!WS2812A_Init(&strip_config, 1))
+  {
+    fprintf(stderr, "strip configuration does not fit in the memory pool of %u bytes\n", WS2812A_POOL_SIZE);
+    return EXIT_FAILURE;
+  }
+
+  BENCH_Result_t results[BENCH_MAX_RESULTS];
+  uint8_t numb_results = BENCH_Run(results, BENCH_MAX_RESULTS);
+  uint8_t index;
+
+  printf("%-24s %10s %14s %14s\n", "benchmark", "calls", BENCH_UNIT "/call", BENCH_UNIT "/item");
+  for(index = 0; index < numb_results; index++)
+  {
+    printf("%-24s %10u %14.1f %14.2f\n", results[index].name, (unsigned)results[index].iterations,
+           (double)results[index].total / results[index].iterations, bench_per_item(&results[index]));
+  }
+
+  if(pWriteName != NULL)
+  {
+    FILE* pFile = fopen(pWriteName, "w");
+    if(pFile == NULL)
+    {
+      perror(pWriteName);
+      return EXIT_FAILURE;
+    }
+    for(index = 0; index < numb_results; index++)
+    {
+      /* names may contain spaces; the value is the last field */
+      fprintf(pFile, "%s;%.3f\n", results[index].name, bench_per_item(&results[index]));
+    }
+    fclose(pFile);
+  }
+
+  int status = EXIT_SUCCESS;
+  if(pBaselineName != NULL)
+  {
+    FILE* pFile = fopen(pBaselineName, "r");
+    if(pFile == NULL)
+    {
+      perror(pBaselineName);
+      return EXIT_FAILURE;
+    }
+    char line[128];
+    while(fgets(line, sizeof(line), pFile) != NULL)
+    {
+      char* pSeparator = strrchr(line, ';');
+      if(pSeparator == NULL)
+      {
+        continue;
+      }
+      *pSeparator = '\0';
+      double baseline = atof(pSeparator + 1);
+      for(index = 0; index < numb_results; index++)
+      {
+        if(strcmp(line, results[index].name) == 0)
+        {
+          double measured = bench_per_item(&results[index]);
+          double change = (baseline > 0.0) ? (measured / baseline - 1.0) * 100.0 : 0.0;
+          bool regression = change > tolerance;
+          printf("%-24s baseline %10.2f measured %10.2f %+7.1f%%%s\n", line, baseline, measured, change,
+                 regression ? "  REGRESSION" : "");
+          if(regression)
+          {
+            status = EXIT_FAILURE;
+          }
+        }
+      }
+    }
+    fclose(pFile);
+  }
+
+  return status;
+}
+
+/* time per processed item */
+static double bench_per_item(const BENCH_Result_t* pResult)
+{
+  return (double)pResult->total / pResult->iterations / pResult->items;
+}
@@ -0,0 +1,344 @@
+/**
+  ******************************************************************************
+  * @file    gen_animation_assets.c
+  * @brief   converter of RGB frame sequences to the animation assets in flash
+  ******************************************************************************
+  * @attention
+  *
+  * usage: gen_animation_assets output_file [-i frame_interval_ms] [-s output] frame_file ...
+  *
+  * Every frame file becomes one asset played by the effect following the effect
+  * registry and the assets of the previous files. A frame file has the format of
+  * the ZB_strip_sim frame dump: a line per frame with the tick [ms], the output
+  * and the RGB colors of the devices as hex triplets. The frames of the selected
+  * output (default 0) are sampled every frame interval (default 20 ms) from the
+  * first tick to the last one; the options apply to the following files.
+  * Every sample is written as a delta record of WS2812A_Asset_t: the runs of the
+  * devices changed since the previous sample; the first sample sets all devices.
+  * The sizes of the assets are reported on stderr.
+  * The demo asset is regenerated with: cmake --build <host build dir> --target animation_assets
+  *
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_ASSETS  64      /* number of assets kept well below the effect indexes of uint8_t */
+#define LINE_SIZE  (8 * 65536)  /* longest line of a frame file */
+
+typedef struct
+{
+  uint32_t tick;
+  uint8_t* pRGB;    /* 3 bytes per device */
+} Frame_t;
+
+typedef struct
+{
+  uint8_t* pData;
+  size_t size;
+  size_t capacity;
+} Record_t;
+
+static Frame_t* read_frames(const char* pFileName, unsigned output, uint32_t* pNumbFrames, uint32_t* pNumbDev);
+static void put_byte(Record_t* pRecord, uint8_t byte);
+static void put_number(Record_t* pRecord, uint32_t number);
+static uint32_t encode_frame(Record_t* pRecord, const uint8_t* pPrevious, const uint8_t* pCurrent, uint32_t numb_dev);
+static uint32_t encode_runs(Record_t* pRecord, const uint8_t* pCurrent, uint32_t first, uint32_t last, uint32_t* pDevice);
+
+int main(int argc, char* argv[])
+{
+  uint32_t frame_interval = 20;
+  unsigned output = 0;
+  unsigned numb_assets = 0;
+  int arg;
+
+  if(argc < 3)
+  {
+    fprintf(stderr, "usage: %s output_file [-i frame_interval_ms] [-s output] frame_file ...\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  FILE* pFile = fopen(argv[1], "w");
+  if(pFile == NULL)
+  {
+    perror(argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  fprintf(pFile, "/* Generated by Host/Src/gen_animation_assets.c - do not edit */\n\n");
+  fprintf(pFile, "#include \"WS2812A_driver.h\"\n");
+
+  char table[MAX_ASSETS][96];   /* entries of the asset table */
+  for(arg = 2; arg < argc; arg++)
+  {
+    if((strcmp(argv[arg], "-i") == 0) && (arg + 1 < argc))
+    {
+      frame_interval = (uint32_t)atol(argv[++arg]);
+      continue;
+    }
+    if((strcmp(argv[arg], "-s") == 0) && (arg + 1 < argc))
+    {
+      output = (unsigned)atoi(argv[++arg]);
+      continue;
+    }
+    if((frame_interval == 0) || (frame_interval > UINT16_MAX) || (numb_assets == MAX_ASSETS))
+    {
+      fprintf(stderr, "%s: frame interval must be 1..%u ms, at most %u assets\n", argv[arg], UINT16_MAX, MAX_ASSETS);
+      return EXIT_FAILURE;
+    }
+
+    uint32_t numb_frames;
+    uint32_t numb_dev;
+    Frame_t* pFrames = read_frames(argv[arg], output, &numb_frames, &numb_dev);
+    if(pFrames == NULL)
+    {
+      return EXIT_FAILURE;
+    }
+
+    /* every sample is the last frame sent until its tick */
+    Record_t record = { NULL, 0, 0 };
+    uint32_t numb_samples = 0;
+    uint32_t numb_changed = 0;
+    uint32_t frame = 0;
+    const uint8_t* pPrevious = NULL;
+    uint32_t tick;
+    for(tick = pFrames[0].tick; tick <= pFrames[numb_frames - 1].tick; tick += frame_interval)
+    {
+      while((frame + 1 < numb_frames) && (pFrames[frame + 1].tick <= tick))
+      {
+        frame++;
+      }
+      numb_changed += encode_frame(&record, pPrevious, pFrames[frame].pRGB, numb_dev);
+      pPrevious = pFrames[frame].pRGB;
+      numb_samples++;
+    }
+    if(numb_samples > UINT16_MAX)
+    {
+      fprintf(stderr, "%s: %u samples exceed %u\n", argv[arg], (unsigned)numb_samples, UINT16_MAX);
+      return EXIT_FAILURE;
+    }
+
+    /* the file name without its path */
+    const char* pName = strrchr(argv[arg], '/');
+    pName = (pName != NULL) ? pName + 1 : argv[arg];
+    fprintf(pFile, "\n/* %s: %u frames of %u devices every %u ms */\n", pName, (unsigned)numb_samples, (unsigned)numb_dev, (unsigned)frame_interval);
+    fprintf(pFile, "static const uint8_t asset%u_data[%u] =\n{", numb_assets, (unsigned)record.size);
+    size_t index;
+    for(index = 0; index < record.size; index++)
+    {
+      fprintf(pFile, "%s0x%02X%s", (index % 16 == 0) ? "\n  " : " ", record.pData[index], (index + 1 < record.size) ? "," : "");
+    }
+    fprintf(pFile, "\n};\n");
+    snprintf(table[numb_assets], sizeof(table[0]), "  { asset%u_data, sizeof(asset%u_data), %u, %u, %u }", numb_assets, numb_assets,
+             (unsigned)numb_dev, (unsigned)numb_samples, (unsigned)frame_interval);
+    numb_assets++;
+
+    fprintf(stderr, "%s: %u frames of %u devices, %u device changes, %u B (%u B as RGB frames)\n", pName, (unsigned)numb_samples,
+            (unsigned)numb_dev, (unsigned)numb_changed, (unsigned)record.size, (unsigned)(numb_samples * numb_dev * 3));
+    free(record.pData);
+    for(frame = 0; frame < numb_frames; frame++)
+    {
+      free(pFrames[frame].pRGB);
+    }
+    free(pFrames);
+  }
+  if(numb_assets == 0)
+  {
+    fprintf(stderr, "no frame file\n");
+    return EXIT_FAILURE;
+  }
+
+  fprintf(pFile, "\n/* assets played by the effects following the effect registry */\n");
+  fprintf(pFile, "const WS2812A_Asset_t WS2812A_assets[] =\n{\n");
+  unsigned asset;
+  for(asset = 0; asset < numb_assets; asset++)
+  {
+    fprintf(pFile, "%s%s\n", table[asset], (asset + 1 < numb_assets) ? "," : "");
+  }
+  fprintf(pFile, "};\n");
+  fprintf(pFile, "const uint8_t WS2812A_numb_assets = sizeof(WS2812A_assets) / sizeof(WS2812A_assets[0]);\n");
+  fclose(pFile);
+
+  return EXIT_SUCCESS;
+}
+
+/* reads the frames of the output from a frame dump; all frames must have the same number of devices */
+static Frame_t* read_frames(const char* pFileName, unsigned output, uint32_t* pNumbFrames, uint32_t* pNumbDev)
+{
+  FILE* pFile = fopen(pFileName, "r");
+  if(pFile == NULL)
+  {
+    perror(pFileName);
+    return NULL;
+  }
+
+  char* pLine = malloc(LINE_SIZE);
+  Frame_t* pFrames = NULL;
+  uint32_t numb_frames = 0;
+  uint32_t numb_dev = 0;
+  while(fgets(pLine, LINE_SIZE, pFile) != NULL)
+  {
+    char* pField;
+    unsigned long tick = strtoul(pLine, &pField, 10);
+    if((pField == pLine) || (strtoul(pField, &pField, 10) != output))
+    {
+      continue;
+    }
+
+    /* the hex triplets of the devices */
+    uint8_t* pRGB = malloc(strlen(pField) / 2 + 3);
+    uint32_t numb_bytes = 0;
+    for(;;)
+    {
+      while(*pField == ' ')
+      {
+        pField++;
+      }
+      unsigned byte;
+      if(sscanf(pField, "%2x", &byte) != 1)
+      {
+        break;
+      }
+      pRGB[numb_bytes++] = (uint8_t)byte;
+      pField += 2;
+    }
+    if((numb_bytes == 0) || (numb_bytes % 3 != 0) || ((numb_frames != 0) && (numb_bytes != numb_dev * 3)) ||
+       ((numb_frames != 0) && (tick < pFrames[numb_frames - 1].tick)))
+    {
+      fprintf(stderr, "%s: frame %u of tick %lu has %u bytes; %u devices expected in the order of ticks\n", pFileName,
+              (unsigned)numb_frames, tick, (unsigned)numb_bytes, (unsigned)numb_dev);
+      fclose(pFile);
+      return NULL;
+    }
+    numb_dev = numb_bytes / 3;
+    pFrames = realloc(pFrames, (numb_frames + 1) * sizeof(Frame_t));
+    pFrames[numb_frames].tick = (uint32_t)tick;
+    pFrames[numb_frames].pRGB = pRGB;
+    numb_frames++;
+  }
+  free(pLine);
+  fclose(pFile);
+  if(numb_frames == 0)
+  {
+    fprintf(stderr, "%s: no frames of output %u\n", pFileName, output);
+    return NULL;
+  }
+
+  *pNumbFrames = numb_frames;
+  *pNumbDev = numb_dev;
+  return pFrames;
+}
+
+static void put_byte(Record_t* pRecord, uint8_t byte)
+{
+  if(pRecord->size == pRecord->capacity)
+  {
+    pRecord->capacity = pRecord->capacity ? 2 * pRecord->capacity : 4096;
+    pRecord->pData = realloc(pRecord->pData, pRecord->capacity);
+  }
+  pRecord->pData[pRecord->size++] = byte;
+}
+
+/* unsigned LEB128 */
+static void put_number(Record_t* pRecord, uint32_t number)
+{
+  while(number >= 0x80)
+  {
+    put_byte(pRecord, (uint8_t)(number | 0x80));
+    number >>= 7;
+  }
+  put_byte(pRecord, (uint8_t)number);
+}
+
+/* writes the delta record of the frame; all devices are changed if there is no previous frame; returns the number of changed devices */
+static uint32_t encode_frame(Record_t* pRecord, const uint8_t* pPrevious, const uint8_t* pCurrent, uint32_t numb_dev)
+{
+  Record_t runs = { NULL, 0, 0 };
+  uint32_t numb_runs = 0;
+  uint32_t numb_changed = 0;
+  uint32_t device = 0;     /* device following the previous run */
+  uint32_t first = 0;
+
+  while(first < numb_dev)
+  {
+    /* a range of changed devices; the unchanged devices are skipped as a new run costs less than a color */
+    if((pPrevious != NULL) && (memcmp(&pPrevious[3 * first], &pCurrent[3 * first], 3) == 0))
+    {
+      first++;
+      continue;
+    }
+    uint32_t last = first;
+    while((last + 1 < numb_dev) && ((pPrevious == NULL) || (memcmp(&pPrevious[3 * (last + 1)], &pCurrent[3 * (last + 1)], 3) != 0)))
+    {
+      last++;
+    }
+    numb_runs += encode_runs(&runs, pCurrent, first, last, &device);
+    numb_changed += last - first + 1;
+    first = last + 1;
+  }
+
+  put_number(pRecord, numb_runs);
+  size_t index;
+  for(index = 0; index < runs.size; index++)
+  {
+    put_byte(pRecord, runs.pData[index]);
+  }
+  free(runs.pData);
+  return numb_changed;
+}
+
+/* writes the changed devices <first,last> as runs of single colors (3 devices or more) and runs of device colors;
+   returns the number of runs */
+static uint32_t encode_runs(Record_t* pRecord, const uint8_t* pCurrent, uint32_t first, uint32_t last, uint32_t* pDevice)
+{
+  uint32_t numb_runs = 0;
+  uint32_t start = first;   /* first device of the run of device colors */
+  uint32_t index = first;
+
+  while(index <= last + 1)
+  {
+    uint32_t end = index;
+    while((end < last) && (memcmp(&pCurrent[3 * (end + 1)], &pCurrent[3 * index], 3) == 0))
+    {
+      end++;
+    }
+    if((index <= last) && (end - index + 1 < 3))
+    {
+      index = end + 1;
+      continue;
+    }
+
+    /* the devices before the single color run or the end */
+    if(index > start)
+    {
+      uint32_t device;
+      put_number(pRecord, start - *pDevice);
+      put_number(pRecord, (index - start) << 1);
+      for(device = start; device < index; device++)
+      {
+        put_byte(pRecord, pCurrent[3 * device]);
+        put_byte(pRecord, pCurrent[3 * device + 1]);
+        put_byte(pRecord, pCurrent[3 * device + 2]);
+      }
+      *pDevice = index;
+      numb_runs++;
+    }
+    if(index > last)
+    {
+      break;
+    }
+    put_number(pRecord, index - *pDevice);
+    put_number(pRecord, ((end - index + 1) << 1) | 1);
+    put_byte(pRecord, pCurrent[3 * index]);
+    put_byte(pRecord, pCurrent[3 * index + 1]);
+    put_byte(pRecord, pCurrent[3 * index + 2]);
+    *pDevice = end + 1;
+    numb_runs++;
+    index = end + 1;
+    start = index;
+  }
+  return numb_runs;
+}
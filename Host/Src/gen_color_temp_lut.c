@@ -0,0 +1,82 @@
+/**
+  ******************************************************************************
+  * @file    gen_color_temp_lut.c
+  * @brief   generator of the color temperature to RGB table
+  ******************************************************************************
+  * @attention
+  *
+  * usage: gen_color_temp_lut output_file
+  *
+  * Every COLOR_TEMP_LUT_STEP mireds from COLOR_TEMP_MIN to COLOR_TEMP_MAX the
+  * color is computed with convert_temp_to_XY() (the polynomial of
+  * doc/temp_to_xy.ods) and convert_XY_to_RGB(), and the table is written as
+  * C source. The largest error of the interpolated table against the direct
+  * conversion is reported on stderr.
+  * The table is regenerated with: cmake --build <host build dir> --target color_temp_lut
+  *
+  ******************************************************************************
+  */
+
+#include "color_conversion.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static RGB_t convert_temp_direct(uint16_t color_temp);
+
+int main(int argc, char* argv[])
+{
+  if(argc != 2)
+  {
+    fprintf(stderr, "usage: %s output_file\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  FILE* pFile = fopen(argv[1], "w");
+  if(pFile == NULL)
+  {
+    perror(argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  fprintf(pFile, "/* Generated by Host/Src/gen_color_temp_lut.c - do not edit */\n\n");
+  fprintf(pFile, "#include \"color_conversion.h\"\n\n");
+  fprintf(pFile, "/* RGB color every %u mireds from %u to %u mireds */\n", COLOR_TEMP_LUT_STEP, COLOR_TEMP_MIN, COLOR_TEMP_MAX);
+  fprintf(pFile, "const RGB_t color_temp_LUT[COLOR_TEMP_LUT_SIZE] =\n{\n");
+  uint16_t idx;
+  for(idx = 0; idx < COLOR_TEMP_LUT_SIZE; idx++)
+  {
+    uint16_t color_temp = COLOR_TEMP_MIN + idx * COLOR_TEMP_LUT_STEP;
+    RGB_t color_rgb = convert_temp_direct(color_temp);
+    fprintf(pFile, "  {0x%02X, 0x%02X, 0x%02X}%s  /* %u */\n", color_rgb.R, color_rgb.G, color_rgb.B,
+            (idx < COLOR_TEMP_LUT_SIZE - 1) ? "," : " ", color_temp);
+  }
+  fprintf(pFile, "};\n");
+  fclose(pFile);
+
+  /* the interpolation in convert_temp_to_RGB() uses the table linked in, which is checked here only if it is up to date */
+  int max_error = 0;
+  uint16_t color_temp;
+  for(color_temp = COLOR_TEMP_MIN; color_temp <= COLOR_TEMP_MAX; color_temp++)
+  {
+    RGB_t direct = convert_temp_direct(color_temp);
+    RGB_t interpolated = convert_temp_to_RGB(color_temp);
+    int errors[3] = { abs(direct.R - interpolated.R), abs(direct.G - interpolated.G), abs(direct.B - interpolated.B) };
+    uint8_t component;
+    for(component = 0; component < 3; component++)
+    {
+      if(errors[component] > max_error)
+      {
+        max_error = errors[component];
+      }
+    }
+  }
+  fprintf(stderr, "%s: %u entries, max interpolation error %d\n", argv[1], COLOR_TEMP_LUT_SIZE, max_error);
+
+  return EXIT_SUCCESS;
+}
+
+/* the conversion the table replaces */
+static RGB_t convert_temp_direct(uint16_t color_temp)
+{
+  return convert_XY_to_RGB(convert_temp_to_XY(color_temp));
+}
@@ -0,0 +1,106 @@
+/**
+  ******************************************************************************
+  * @file    gen_gamma_lut.c
+  * @brief   generator of the 8-bit gamma encoding thresholds
+  ******************************************************************************
+  * @attention
+  *
+  * usage: gen_gamma_lut output_file
+  *
+  * For every 8-bit output value the smallest float input is searched that
+  * gamma_correction() scaled to 0..255 maps to this value; the thresholds are
+  * written as C source for gamma_encode().
+  * Then all floats of the input range 0..1 are encoded both ways and the
+  * largest difference is reported on stderr; the exit status is nonzero
+  * if it exceeds 1 (it is 0 when the linked table is up to date).
+  * The table is regenerated with: cmake --build <host build dir> --target gamma_lut
+  *
+  ******************************************************************************
+  */
+
+#include "color_conversion.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t gamma_reference(float value);
+static float float_from_bits(uint32_t bits);
+
+int main(int argc, char* argv[])
+{
+  const uint32_t One_bits = 0x3F800000;   /* 1.0f */
+
+  if(argc != 2)
+  {
+    fprintf(stderr, "usage: %s output_file\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  FILE* pFile = fopen(argv[1], "w");
+  if(pFile == NULL)
+  {
+    perror(argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  fprintf(pFile, "/* Generated by Host/Src/gen_gamma_lut.c - do not edit */\n\n");
+  fprintf(pFile, "#include \"color_conversion.h\"\n\n");
+  fprintf(pFile, "/* smallest linear value encoded to every 8-bit gamma value */\n");
+  fprintf(pFile, "const float gamma_threshold[256] =\n{\n  0.0f,");
+  uint16_t value;
+  for(value = 1; value < 256; value++)
+  {
+    /* non-negative floats are ordered like their bit patterns */
+    uint32_t low = 0;
+    uint32_t high = One_bits;
+    while(low < high)
+    {
+      uint32_t middle = low + (high - low) / 2;
+      if(gamma_reference(float_from_bits(middle)) >= value)
+      {
+        high = middle;
+      }
+      else
+      {
+        low = middle + 1;
+      }
+    }
+    fprintf(pFile, "%s%.9ef%s", (value % 4 == 0) ? "\n  " : " ", (double)float_from_bits(low), (value < 255) ? "," : "");
+  }
+  fprintf(pFile, "\n};\n");
+  fclose(pFile);
+
+  /* exhaustive check of the linked table */
+  uint32_t bits;
+  int max_error = 0;
+  uint32_t numb_errors = 0;
+  for(bits = 0; bits <= One_bits; bits++)
+  {
+    float linear = float_from_bits(bits);
+    int error = abs(gamma_reference(linear) - gamma_encode(linear));
+    if(error != 0)
+    {
+      numb_errors++;
+      if(error > max_error)
+      {
+        max_error = error;
+      }
+    }
+  }
+  fprintf(stderr, "%s: %u inputs checked, %u differ, max error %d\n", argv[1], (unsigned)(One_bits + 1), (unsigned)numb_errors, max_error);
+
+  return (max_error > 1) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* the encoding as done in convert_XY_to_RGB() before the table */
+static uint8_t gamma_reference(float value)
+{
+  return (uint8_t)(gamma_correction(value) * 255 + 0.5);
+}
+
+static float float_from_bits(uint32_t bits)
+{
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
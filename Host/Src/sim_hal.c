@@ -0,0 +1,404 @@
+/**
+  ******************************************************************************
+  * @file    sim_hal.c
+  * @brief   simulated HAL, sequencer and SPI DMA for the host build
+  ******************************************************************************
+  * @attention
+  *
+  * SPI DMA transfers last as long as on the target at sim_pclk_freq.
+  * At the end of a transfer the pulses are decoded back into device
+  * colors and the frame is written as a text line:
+  *   <tick ms> <SPI index> <RRGGBB of 1st device> <RRGGBB of 2nd device> ...
+  * The colors are printed in the order the devices receive them.
+  * The lanes of the GPIO port written by the update DMA of sim_tim are
+  * decoded from the written bytes; lane n is printed as output SIM_NUMB_SPI + n.
+  * A circular DMA transfer (hdmatx->Init.Mode == DMA_CIRCULAR) signals its
+  * halves at their simulated end times; the streamed bytes are collected
+  * and decoded as one frame when HAL_SPI_DMAStop() stops the transfer.
+  * The timer server timers expire at the millisecond ticks; their callbacks
+  * are called like from the RTC wakeup interrupt.
+  *
+  ******************************************************************************
+  */
+
+#include "sim_hal.h"
+#include "app_common.h"
+#include "stm32_seq.h"
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#define SIM_NUMB_TASKS  32      /* number of sequencer task bits */
+#define SIM_SERIAL  0xFF       /* the decoded line is the serial output of an SPI */
+#define SIM_STREAM_SIZE  (128 * 1024)   /* capacity of the collected bytes of a circular transfer [B] */
+
+typedef struct
+{
+  const uint8_t* pData;     /* buffer streamed by DMA */
+  uint16_t size;            /* number of bytes in the buffer */
+  uint32_t end_tick;        /* tick of the transfer end */
+  uint64_t half_us;         /* duration of a half of a circular transfer [us] */
+  uint64_t half_end_us;     /* simulated time of the end of the next half of a circular transfer [us] */
+  uint8_t half;             /* the next half of a circular transfer to end */
+  uint32_t numb_streamed;   /* number of bytes collected from a circular transfer */
+} Sim_Transfer_t;
+
+typedef struct
+{
+  HW_TS_pTimerCb_t callback;    /* called at the timer expiry */
+  HW_TS_Mode_t mode;
+  uint64_t period_us;       /* timeout of the timer [us] */
+  uint64_t expiry_us;       /* simulated time of the next expiry [us] */
+  bool running;
+} Sim_Timer_t;
+
+SPI_HandleTypeDef sim_spi[SIM_NUMB_SPI];
+DMA_HandleTypeDef sim_dma[SIM_NUMB_SPI];
+TIM_HandleTypeDef sim_tim;
+GPIO_TypeDef sim_gpio;
+uint32_t sim_pclk_freq = SIM_PCLK_FREQ;
+
+static volatile uint32_t sim_tick = 0;
+static void (*sim_task[SIM_NUMB_TASKS])(void);
+static UTIL_SEQ_bm_t sim_task_pending = 0;
+static Sim_Transfer_t sim_transfer[SIM_NUMB_SPI];
+static TIM_TypeDef sim_tim_regs;
+static DMA_HandleTypeDef sim_tim_dma;
+static Sim_Transfer_t sim_port_transfer;    /* transfer of the update DMA of sim_tim to sim_gpio */
+static uint8_t sim_stream[SIM_NUMB_SPI][SIM_STREAM_SIZE];   /* bytes sent by the circular transfers */
+static FILE* pSim_output = NULL;
+static Sim_Stats_t sim_stats;
+static Sim_Timer_t sim_timer[CFG_HW_TS_MAX_NBR_CONCURRENT_TIMER];
+static uint8_t sim_numb_timers = 0;
+
+static void sim_decode_frame(uint8_t output, const uint8_t* pData, uint32_t numb_bits, uint8_t lane);
+static void sim_stream_halves(uint8_t spi_index);
+
+/* resets the simulation; frames are written to pFrameOutput unless it is NULL; the TX DMA channels are in normal mode */
+void sim_hal_init(FILE* pFrameOutput)
+{
+  uint8_t spi_index;
+
+  pSim_output = pFrameOutput;
+  sim_pclk_freq = SIM_PCLK_FREQ;
+  sim_tick = 0;
+  sim_task_pending = 0;
+  sim_numb_timers = 0;
+  memset(&sim_stats, 0, sizeof(sim_stats));
+  for(spi_index = 0; spi_index < SIM_NUMB_SPI; spi_index++)
+  {
+    memset(&sim_spi[spi_index], 0, sizeof(SPI_HandleTypeDef));
+    sim_spi[spi_index].Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_16;
+    sim_spi[spi_index].State = HAL_SPI_STATE_READY;
+    memset(&sim_dma[spi_index], 0, sizeof(DMA_HandleTypeDef));
+    sim_dma[spi_index].Init.Mode = DMA_NORMAL;
+    sim_spi[spi_index].hdmatx = &sim_dma[spi_index];
+  }
+  memset(&sim_tim, 0, sizeof(sim_tim));
+  memset(&sim_tim_regs, 0, sizeof(sim_tim_regs));
+  memset(&sim_tim_dma, 0, sizeof(sim_tim_dma));
+  memset(&sim_gpio, 0, sizeof(sim_gpio));
+  sim_tim.Instance = &sim_tim_regs;
+  sim_tim.hdma[TIM_DMA_ID_UPDATE] = &sim_tim_dma;
+  sim_tim_dma.Parent = &sim_tim;
+  sim_tim_dma.Init.Mode = DMA_NORMAL;
+  sim_tim_dma.State = HAL_DMA_STATE_READY;
+}
+
+/* advances the simulated time by 1 ms, completes the finished SPI DMA transfers and expires the timers */
+void sim_hal_tick(void)
+{
+  uint8_t spi_index;
+  uint8_t timer_id;
+
+  sim_tick++;
+  for(spi_index = 0; spi_index < SIM_NUMB_SPI; spi_index++)
+  {
+    SPI_HandleTypeDef* hspi = &sim_spi[spi_index];
+    if(hspi->hdmatx->Init.Mode == DMA_CIRCULAR)
+    {
+      sim_stream_halves(spi_index);
+    }
+    else if((hspi->State == HAL_SPI_STATE_BUSY_TX) && (sim_tick >= sim_transfer[spi_index].end_tick))
+    {
+      /* the buffer is decoded at the end of the transfer, so writes during DMA show up as torn frames */
+      sim_decode_frame(spi_index, sim_transfer[spi_index].pData, (uint32_t)sim_transfer[spi_index].size * 8, SIM_SERIAL);
+      hspi->State = HAL_SPI_STATE_READY;
+      HAL_SPI_TxCpltCallback(hspi);
+    }
+  }
+  if((sim_tim_dma.State == HAL_DMA_STATE_BUSY) && (sim_tick >= sim_port_transfer.end_tick))
+  {
+    /* the first byte sets all lanes high */
+    uint8_t lane;
+    for(lane = 0; lane < 8; lane++)
+    {
+      if((sim_port_transfer.pData[0] & (1 << lane)) != 0)
+      {
+        sim_decode_frame(SIM_NUMB_SPI + lane, sim_port_transfer.pData, sim_port_transfer.size, lane);
+      }
+    }
+    sim_gpio.ODR = sim_port_transfer.pData[sim_port_transfer.size - 1];
+    sim_tim_dma.State = HAL_DMA_STATE_READY;
+    sim_tim_dma.XferCpltCallback(&sim_tim_dma);
+  }
+  for(timer_id = 0; timer_id < sim_numb_timers; timer_id++)
+  {
+    Sim_Timer_t* pTimer = &sim_timer[timer_id];
+    while(pTimer->running && (pTimer->expiry_us <= (uint64_t)sim_tick * 1000))
+    {
+      pTimer->expiry_us += pTimer->period_us;
+      pTimer->running = (pTimer->mode == hw_ts_Repeated);
+      pTimer->callback();
+    }
+  }
+}
+
+/* calls all pending sequencer tasks and measures their execution time */
+void sim_hal_run_tasks(void)
+{
+  uint8_t task_index;
+
+  for(task_index = 0; task_index < SIM_NUMB_TASKS; task_index++)
+  {
+    UTIL_SEQ_bm_t task_bm = (UTIL_SEQ_bm_t)1 << task_index;
+    if(((sim_task_pending & task_bm) != 0) && (sim_task[task_index] != NULL))
+    {
+      struct timespec start, stop;
+      sim_task_pending &= ~task_bm;
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      sim_task[task_index]();
+      clock_gettime(CLOCK_MONOTONIC, &stop);
+      uint64_t time_ns = (uint64_t)(stop.tv_sec - start.tv_sec) * 1000000000ULL + stop.tv_nsec - start.tv_nsec;
+      sim_stats.task_calls++;
+      sim_stats.task_time_ns += time_ns;
+      if(time_ns > sim_stats.task_time_max_ns)
+      {
+        sim_stats.task_time_max_ns = time_ns;
+      }
+    }
+  }
+}
+
+/* returns the simulation statistics */
+const Sim_Stats_t* sim_hal_get_stats(void)
+{
+  return &sim_stats;
+}
+
+/* collects the halves of the circular transfer sent until the current tick; the callbacks may refill or stop the transfer */
+static void sim_stream_halves(uint8_t spi_index)
+{
+  SPI_HandleTypeDef* hspi = &sim_spi[spi_index];
+  Sim_Transfer_t* pTransfer = &sim_transfer[spi_index];
+  uint16_t half_size = pTransfer->size / 2;
+
+  while((hspi->State == HAL_SPI_STATE_BUSY_TX) && (pTransfer->half_end_us <= (uint64_t)sim_tick * 1000))
+  {
+    if(pTransfer->numb_streamed + half_size <= SIM_STREAM_SIZE)
+    {
+      memcpy(&sim_stream[spi_index][pTransfer->numb_streamed], pTransfer->pData + pTransfer->half * half_size, half_size);
+      pTransfer->numb_streamed += half_size;
+    }
+    pTransfer->half_end_us += pTransfer->half_us;
+    if(pTransfer->half == 0)
+    {
+      pTransfer->half = 1;
+      HAL_SPI_TxHalfCpltCallback(hspi);
+    }
+    else
+    {
+      pTransfer->half = 0;
+      HAL_SPI_TxCpltCallback(hspi);
+    }
+  }
+}
+
+/* decodes the pulses of a line into device colors; a device bit 1 is a pulse of at least 2 high SPI bits or timer slots;
+   the line is the serial SPI bits (SIM_SERIAL) or the bit of the lane in every byte written to the port */
+static void sim_decode_frame(uint8_t output, const uint8_t* pData, uint32_t numb_bits, uint8_t lane)
+{
+  uint32_t high_length = 0;     /* number of high SPI bits of the current pulse */
+  uint8_t byte = 0;
+  uint8_t bit_count = 0;
+  uint32_t byte_count = 0;
+  uint32_t index;
+
+  sim_stats.frames_out++;
+  if(pSim_output == NULL)
+  {
+    return;
+  }
+
+  fprintf(pSim_output, "%u %u", (unsigned)sim_tick, (unsigned)output);
+  for(index = 0; index < numb_bits; index++)
+  {
+    bool line_bit = (lane == SIM_SERIAL) ? ((pData[index / 8] & (0x80 >> (index % 8))) != 0) : ((pData[index] & (1 << lane)) != 0);
+    if(line_bit)
+    {
+      high_length++;
+    }
+    else if(high_length > 0)
+    {
+      /* falling edge ends a device bit */
+      byte = (uint8_t)((byte << 1) | ((high_length >= 2) ? 1 : 0));
+      high_length = 0;
+      if(++bit_count == 8)
+      {
+        fprintf(pSim_output, (byte_count % 3 == 0) ? " %02X" : "%02X", byte);
+        byte_count++;
+        bit_count = 0;
+      }
+    }
+  }
+  fprintf(pSim_output, "\n");
+}
+
+uint32_t HAL_GetTick(void)
+{
+  return sim_tick;
+}
+
+void UTIL_SEQ_RegTask(UTIL_SEQ_bm_t TaskId_bm, uint32_t Flags, void (*Task)(void))
+{
+  uint8_t task_index;
+
+  (void)Flags;
+  for(task_index = 0; task_index < SIM_NUMB_TASKS; task_index++)
+  {
+    if((TaskId_bm & ((UTIL_SEQ_bm_t)1 << task_index)) != 0)
+    {
+      sim_task[task_index] = Task;
+    }
+  }
+}
+
+void UTIL_SEQ_SetTask(UTIL_SEQ_bm_t TaskId_bm, uint32_t Task_Prio)
+{
+  (void)Task_Prio;
+  sim_task_pending |= TaskId_bm;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size)
+{
+  uint8_t spi_index = (uint8_t)(hspi - sim_spi);
+
+  if((spi_index >= SIM_NUMB_SPI) || (pData == NULL) || (Size == 0))
+  {
+    return HAL_ERROR;
+  }
+  if(hspi->State != HAL_SPI_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* transfer time at the configured SPI clock, rounded up to full ticks */
+  uint32_t divider = 2UL << (hspi->Init.BaudRatePrescaler >> SPI_CR1_BR_Pos);
+  uint64_t duration_us = (uint64_t)Size * 8 * 1000000ULL * divider / sim_pclk_freq;
+  sim_transfer[spi_index].pData = pData;
+  sim_transfer[spi_index].size = Size;
+  sim_transfer[spi_index].end_tick = sim_tick + (uint32_t)((duration_us + 999) / 1000);
+  sim_transfer[spi_index].half_us = duration_us / 2;
+  sim_transfer[spi_index].half_end_us = (uint64_t)sim_tick * 1000 + duration_us / 2;
+  sim_transfer[spi_index].half = 0;
+  sim_transfer[spi_index].numb_streamed = 0;
+  hspi->State = HAL_SPI_STATE_BUSY_TX;
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
+{
+  /* the transfers follow the prescaler in hspi->Init */
+  return (hspi->State == HAL_SPI_STATE_READY) ? HAL_OK : HAL_BUSY;
+}
+
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
+{
+  uint8_t spi_index = (uint8_t)(hspi - sim_spi);
+
+  if(spi_index >= SIM_NUMB_SPI)
+  {
+    return HAL_ERROR;
+  }
+
+  if(hspi->State == HAL_SPI_STATE_BUSY_TX)
+  {
+    /* the bytes of a circular transfer form the frame; a normal transfer is cut off */
+    if(hspi->hdmatx->Init.Mode == DMA_CIRCULAR)
+    {
+      sim_decode_frame(spi_index, sim_stream[spi_index], sim_transfer[spi_index].numb_streamed * 8, SIM_SERIAL);
+    }
+    hspi->State = HAL_SPI_STATE_READY;
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength)
+{
+  if((hdma != &sim_tim_dma) || (DstAddress != (uint32_t)(uintptr_t)&sim_gpio.ODR) || (DataLength == 0))
+  {
+    return HAL_ERROR;
+  }
+  if(hdma->State != HAL_DMA_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* the 32-bit DMA address is the low half of a host address in the image of the program */
+  sim_port_transfer.pData = (const uint8_t*)(((uintptr_t)&sim_gpio & ~(uintptr_t)UINT32_MAX) | SrcAddress);
+  sim_port_transfer.size = (uint16_t)DataLength;
+  /* a byte per update event of the timer clocked at sim_pclk_freq */
+  uint64_t duration_us = (uint64_t)DataLength * (sim_tim_regs.ARR + 1) * (sim_tim_regs.PSC + 1) * 1000000ULL / sim_pclk_freq;
+  sim_port_transfer.end_tick = sim_tick + (uint32_t)((duration_us + 999) / 1000);
+  hdma->State = HAL_DMA_STATE_BUSY;
+
+  return HAL_OK;
+}
+
+void HAL_RCC_GetClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t *pFLatency)
+{
+  memset(RCC_ClkInitStruct, 0, sizeof(RCC_ClkInitTypeDef));
+  RCC_ClkInitStruct->APB1CLKDivider = RCC_HCLK_DIV1;
+  RCC_ClkInitStruct->APB2CLKDivider = RCC_HCLK_DIV1;
+  *pFLatency = 0;
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+  return sim_pclk_freq;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void)
+{
+  return sim_pclk_freq;
+}
+
+HW_TS_ReturnStatus_t HW_TS_Create(uint32_t TimerProcessID, uint8_t *pTimerId, HW_TS_Mode_t TimerMode, HW_TS_pTimerCb_t pftimeout_handler)
+{
+  (void)TimerProcessID;
+  if(sim_numb_timers == CFG_HW_TS_MAX_NBR_CONCURRENT_TIMER)
+  {
+    return hw_ts_Failed;
+  }
+  sim_timer[sim_numb_timers].callback = pftimeout_handler;
+  sim_timer[sim_numb_timers].mode = TimerMode;
+  sim_timer[sim_numb_timers].running = false;
+  *pTimerId = sim_numb_timers++;
+
+  return hw_ts_Successful;
+}
+
+void HW_TS_Start(uint8_t timer_id, uint32_t timeout_ticks)
+{
+  /* the timeout in the real length of the timer server tick */
+  sim_timer[timer_id].period_us = (uint64_t)timeout_ticks * CFG_TS_TICK_VAL_PS / 1000000;
+  sim_timer[timer_id].expiry_us = (uint64_t)sim_tick * 1000 + sim_timer[timer_id].period_us;
+  sim_timer[timer_id].running = true;
+}
+
+void HW_TS_Stop(uint8_t timer_id)
+{
+  sim_timer[timer_id].running = false;
+}
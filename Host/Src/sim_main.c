@@ -0,0 +1,211 @@
+/**
+  ******************************************************************************
+  * @file    sim_main.c
+  * @brief   host simulation of the light engine with frame dump
+  ******************************************************************************
+  * @attention
+  *
+  * usage: ZB_strip_sim [-n devices] [-s strips|-p lanes] [-c] [-e 3|4|5] [-k spi_clock_hz] [-d duration_ms] [-l level]
+  *                     [-m effect] [-x X,Y [-T transition_ms]] [-t mireds] [-r seed] [-o file|-q]
+  *
+  * -c streams the pulses of the strips through their pulse rings and circular DMA.
+  * -e selects the SPI bits per device bit; -k sets the SPI kernel clock the prescaler is selected from.
+  * -p drives the lanes of a GPIO port by the timer-triggered DMA instead of the SPIs;
+  * every lane has -n devices.
+  * -m selects the effect; the indexes following the effect registry play the animation assets.
+  *
+  * The light is switched on at the given level (without transition) by the
+  * commands of the options; then the frame task is triggered by the frame clock of the driver
+  * on the simulated timer server. The command latency is measured in whole
+  * milliseconds of the simulated time.
+  * Frames go to stdout (or the -o file); statistics go to stderr.
+  *
+  ******************************************************************************
+  */
+
+#include "sim_hal.h"
+#include "WS2812A_driver.h"
+#include "prng.h"
+#include <stdlib.h>
+#include <unistd.h>
+
+int main(int argc, char* argv[])
+{
+  uint16_t numb_dev = 100;
+  uint8_t numb_strips = 1;
+  WS2812A_ParallelConfig_t parallel_config = { &sim_tim, &sim_gpio, 0 };
+  bool streaming = false;
+  WS2812A_EncodingTypeDef encoding = WS2812A_ENCODING_5BIT;
+  uint32_t spi_clock = SIM_PCLK_FREQ;
+  uint32_t duration = 2000;
+  uint8_t level = 0xFE;
+  int effect = -1;
+  WS2812A_Command_t xy_command = { .type = WS2812A_CMD_COLOR_XY };
+  bool set_color_xy = false;
+  uint16_t color_temp = 0;
+  FILE* pOutput = stdout;
+  int option;
+
+  while((option = getopt(argc, argv, "n:s:p:ce:k:d:l:m:x:T:t:r:o:q")) != -1)
+  {
+    switch(option)
+    {
+      case 'n':
+      numb_dev = (uint16_t)atoi(optarg);
+      break;
+
+      case 's':
+      numb_strips = (uint8_t)atoi(optarg);
+      break;
+
+      case 'p':
+      parallel_config.numb_lanes = (uint8_t)atoi(optarg);
+      break;
+
+      case 'c':
+      streaming = true;
+      break;
+
+      case 'e':
+      encoding = (atoi(optarg) == 3) ? WS2812A_ENCODING_3BIT : (atoi(optarg) == 4) ? WS2812A_ENCODING_4BIT : WS2812A_ENCODING_5BIT;
+      break;
+
+      case 'k':
+      spi_clock = (uint32_t)atol(optarg);
+      break;
+
+      case 'd':
+      duration = (uint32_t)atol(optarg);
+      break;
+
+      case 'l':
+      level = (uint8_t)atoi(optarg);
+      break;
+
+      case 'm':
+      effect = atoi(optarg);
+      break;
+
+      case 'x':
+      {
+        unsigned x, y;
+        if(sscanf(optarg, "%u,%u", &x, &y) == 2)
+        {
+          xy_command.color_xy.color_xy.X = (uint16_t)x;
+          xy_command.color_xy.color_xy.Y = (uint16_t)y;
+          set_color_xy = true;
+        }
+      }
+      break;
+
+      case 'T':
+      xy_command.color_xy.transition_time = (uint32_t)atol(optarg);
+      break;
+
+      case 'r':
+      PRNG_Init(strtoull(optarg, NULL, 0));
+      break;
+
+      case 't':
+      color_temp = (uint16_t)atoi(optarg);
+      break;
+
+      case 'o':
+      pOutput = fopen(optarg, "w");
+      if(pOutput == NULL)
+      {
+        perror(optarg);
+        return EXIT_FAILURE;
+      }
+      break;
+
+      case 'q':
+      pOutput = NULL;
+      break;
+
+      default:
+      fprintf(stderr, "usage: %s [-n devices] [-s strips|-p lanes] [-c] [-e 3|4|5] [-k spi_clock_hz] [-d duration_ms] [-l level] [-m effect] [-x X,Y [-T transition_ms]] [-t mireds] [-r seed] [-o file|-q]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if((numb_strips == 0) || (numb_strips > WS2812A_MAX_STRIPS) || (numb_strips > SIM_NUMB_SPI))
+  {
+    fprintf(stderr, "number of strips must be 1..%u\n", WS2812A_MAX_STRIPS);
+    return EXIT_FAILURE;
+  }
+
+  sim_hal_init(pOutput);
+  sim_pclk_freq = spi_clock;
+
+  WS2812A_StripConfig_t strip_config[WS2812A_MAX_STRIPS];
+  uint8_t strip;
+  for(strip = 0; strip < numb_strips; strip++)
+  {
+    strip_config[strip].phSPI = &sim_spi[strip];
+    strip_config[strip].numb_dev = numb_dev;
+    strip_config[strip].color_order = WS2812A_ORDER_RGB;
+    strip_config[strip].streaming = streaming;
+    strip_config[strip].encoding = encoding;
+    strip_config[strip].pParallel = NULL;
+    sim_dma[strip].Init.Mode = streaming ? DMA_CIRCULAR : DMA_NORMAL;
+  }
+  if(parallel_config.numb_lanes != 0)
+  {
+    numb_strips = 1;
+    strip_config[0].phSPI = NULL;
+    strip_config[0].pParallel = &parallel_config;
+  }
+  if(!WS2812A_Init(strip_config, numb_strips))
+  {
+    fprintf(stderr, "strip configuration does not fit in the memory pool of %u bytes or its SPI timing is out of tolerance\n", WS2812A_POOL_SIZE);
+    return EXIT_FAILURE;
+  }
+
+  /* switch the light on with the commands of the options */
+  WS2812A_StartClock();
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_LEVEL_MOVE_TO, .level_move_to = { level, true, 0 } });
+  if(set_color_xy)
+  {
+    WS2812A_PostCommand(&xy_command);
+  }
+  if(color_temp != 0)
+  {
+    WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_TEMP_MOVE_TO, .temp_move_to = { color_temp, 0 } });
+  }
+  if((effect >= 0) && (effect < WS2812A_GetNumbEffects()))
+  {
+    WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_LOOP_START, .loop_start = { 0, (uint8_t)effect, WS2812A_LOOP_DIR_KEEP } });
+  }
+
+  uint32_t tick;
+  for(tick = 0; tick < duration; tick++)
+  {
+    sim_hal_tick();
+    sim_hal_run_tasks();
+  }
+
+  const Sim_Stats_t* pSimStats = sim_hal_get_stats();
+  const WS2812A_Stats_t* pStats = WS2812A_GetStats();
+  fprintf(stderr, "devices: %u x %u, duration: %u ms\n", (parallel_config.numb_lanes != 0) ? (unsigned)parallel_config.numb_lanes : (unsigned)numb_strips,
+          (unsigned)numb_dev, (unsigned)duration);
+  fprintf(stderr, "frame task: %u calls, mean %.2f us, max %.2f us\n", (unsigned)pSimStats->task_calls,
+          (pSimStats->task_calls != 0) ? pSimStats->task_time_ns / 1000.0 / pSimStats->task_calls : 0.0,
+          pSimStats->task_time_max_ns / 1000.0);
+  fprintf(stderr, "frames: %u sent, %u deferred, %u dropped, %u output\n", (unsigned)pStats->frames_sent,
+          (unsigned)pStats->frames_deferred, (unsigned)pStats->frames_dropped, (unsigned)pSimStats->frames_out);
+  fprintf(stderr, "command latency: %u requested frames, mean %u us, max %u us\n", (unsigned)pStats->requested_frames,
+          (pStats->requested_frames != 0) ? (unsigned)(pStats->latency_total / pStats->requested_frames) : 0,
+          (unsigned)pStats->latency_max);
+  fprintf(stderr, "commands: %u collapsed, %u dropped\n", (unsigned)pStats->commands_collapsed, (unsigned)pStats->commands_dropped);
+#ifdef WS2812A_INDEXED_COLORS
+  fprintf(stderr, "palette: %u colors merged\n", (unsigned)pStats->colors_merged);
+#endif
+
+  if((pOutput != NULL) && (pOutput != stdout))
+  {
+    fclose(pOutput);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -46,6 +46,7 @@
 #include "main.h"
 #include "zcl/general/zcl.basic.h"
 #include "WS2812A_driver.h"
+#include "prng.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -65,8 +66,8 @@
 
 /* USER CODE BEGIN PD */
 #define ZCL_LEVEL_ATTR_ONOFF_TRANS_TIME_DEFAULT	10
-#define ATTR_COLOR_TEMP_BEGIN		100 /* shade skylight mireds */
-#define ATTR_COLOR_TEMP_END 		450 /* incandescent bulb mireds */
+#define ATTR_COLOR_TEMP_BEGIN		COLOR_TEMP_MIN /* shade skylight mireds */
+#define ATTR_COLOR_TEMP_END 		COLOR_TEMP_MAX /* incandescent bulb mireds */
 #define ATTR_COLOR_TEMP_DAYLIGHT  175 /* daylight mireds */
 /* USER CODE END PD */
 
@@ -97,6 +98,8 @@ static void APP_ZIGBEE_ProcessRequestM0ToM4(void);
 
 /* USER CODE BEGIN PFP */
 static void APP_ZIGBEE_JoinReq(struct ZigBeeT* zb, void* arg);
+static void APP_ZIGBEE_SetColorModeHS(struct ZbZclClusterT *cluster, bool enhanced);
+static void APP_ZIGBEE_SetColorModeTemp(struct ZbZclClusterT *cluster);
 /* USER CODE END PFP */
 
 /* Private variables ---------------------------------------------------------*/
@@ -220,7 +223,7 @@ static enum ZclStatusCodeT onOff_server_1_off(struct ZbZclClusterT *cluster, str
     APP_DBG("onOff_server_1_off");
     (void)ZbZclAttrIntegerWrite(cluster, ZCL_ONOFF_ATTR_ONOFF, 0);
     HAL_GPIO_WritePin(LED_G_GPIO_Port, LED_G_Pin, GPIO_PIN_RESET);
-    light_params.level_target = 0;
+    WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_OFF });
   }
   else 
   {
@@ -243,7 +246,7 @@ static enum ZclStatusCodeT onOff_server_1_on(struct ZbZclClusterT *cluster, stru
     APP_DBG("onOff_server_1_on");
     (void)ZbZclAttrIntegerWrite(cluster, ZCL_ONOFF_ATTR_ONOFF, 1);
     HAL_GPIO_WritePin(LED_G_GPIO_Port, LED_G_Pin, GPIO_PIN_SET);
-    light_params.level_target = light_params.level_on;
+    WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_ON });
   }
   else 
   {
@@ -282,7 +285,10 @@ static enum ZclStatusCodeT onOff_server_1_toggle(struct ZbZclClusterT *cluster,
 static enum ZclStatusCodeT colorControl_server_1_move_to_hue(struct ZbZclClusterT *cluster, struct ZbZclColorClientMoveToHueReqT *req, struct ZbZclAddrInfoT *srcInfo, void *arg)
 {
   /* USER CODE BEGIN 3 ColorControl server 1 move_to_hue 1 */
-  APP_DBG("colorControl_server_1_move_to_hue");
+  APP_DBG("colorControl_server_1_move_to_hue, hue=%u, dir=%u, trans=%u", req->hue, req->direction, req->transition_time);
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_HUE_SAT_MOVE_TO,
+                                            .hue_sat_move_to = { WS2812A_HUE, (uint16_t)req->hue << 8, 0, (WS2812A_HueDirTypeDef)req->direction, req->transition_time * 100 } });
+  APP_ZIGBEE_SetColorModeHS(cluster, false);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 3 ColorControl server 1 move_to_hue 1 */
 }
@@ -293,18 +299,9 @@ static enum ZclStatusCodeT colorControl_server_1_move_hue(struct ZbZclClusterT *
   /* USER CODE BEGIN 4 ColorControl server 1 move_hue 1 */
   APP_DBG("colorControl_server_1_move_hue, mode=%u, rate=%u, mask=%u, override=%u", req->move_mode, req->rate, req->mask, req->override);
 
-  if(req->move_mode == 1)
-  {
-    //increment loop mode
-    light_params.color_loop_mode = (light_params.color_loop_mode < COLOR_LOOP_NUMB_MODES - 1) ? light_params.color_loop_mode + 1 : 0;
-  }
-  else
-  {
-    //decrement loop mode
-    light_params.color_loop_mode = (light_params.color_loop_mode > 0) ? light_params.color_loop_mode - 1 : COLOR_LOOP_NUMB_MODES - 1;
-  }
-
-  light_params.color_mode = COLOR_LOOP;
+  //select the next or previous effect
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_LOOP_START,
+                                            .loop_start = { (req->move_mode == 1) ? 1 : -1, 0, WS2812A_LOOP_DIR_KEEP } });
 
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 4 ColorControl server 1 move_hue 1 */
@@ -314,7 +311,11 @@ static enum ZclStatusCodeT colorControl_server_1_move_hue(struct ZbZclClusterT *
 static enum ZclStatusCodeT colorControl_server_1_step_hue(struct ZbZclClusterT *cluster, struct ZbZclColorClientStepHueReqT *req, struct ZbZclAddrInfoT *srcInfo, void *arg)
 {
   /* USER CODE BEGIN 5 ColorControl server 1 step_hue 1 */
-  APP_DBG("colorControl_server_1_step_hue");
+  APP_DBG("colorControl_server_1_step_hue, mode=%u, step=%u, trans=%u", req->step_mode, req->step_size, req->transition_time);
+  int32_t step = (int32_t)req->step_size << 8;
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_HUE_SAT_STEP,
+                                            .hue_sat_step = { WS2812A_HUE, (req->step_mode == 1) ? step : -step, req->transition_time * 100 } });
+  APP_ZIGBEE_SetColorModeHS(cluster, false);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 5 ColorControl server 1 step_hue 1 */
 }
@@ -323,7 +324,10 @@ static enum ZclStatusCodeT colorControl_server_1_step_hue(struct ZbZclClusterT *
 static enum ZclStatusCodeT colorControl_server_1_move_to_sat(struct ZbZclClusterT *cluster, struct ZbZclColorClientMoveToSatReqT *req, struct ZbZclAddrInfoT *srcInfo, void *arg)
 {
   /* USER CODE BEGIN 6 ColorControl server 1 move_to_sat 1 */
-  APP_DBG("colorControl_server_1_move_to_sat");
+  APP_DBG("colorControl_server_1_move_to_sat, sat=%u, trans=%u", req->sat, req->transition_time);
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_HUE_SAT_MOVE_TO,
+                                            .hue_sat_move_to = { WS2812A_SAT, 0, req->sat, WS2812A_HUE_SHORTEST, req->transition_time * 100 } });
+  APP_ZIGBEE_SetColorModeHS(cluster, false);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 6 ColorControl server 1 move_to_sat 1 */
 }
@@ -332,7 +336,11 @@ static enum ZclStatusCodeT colorControl_server_1_move_to_sat(struct ZbZclCluster
 static enum ZclStatusCodeT colorControl_server_1_move_sat(struct ZbZclClusterT *cluster, struct ZbZclColorClientMoveSatReqT *req, struct ZbZclAddrInfoT *srcInfo, void *arg)
 {
   /* USER CODE BEGIN 7 ColorControl server 1 move_sat 1 */
-  APP_DBG("colorControl_server_1_move_sat");
+  APP_DBG("colorControl_server_1_move_sat, mode=%u, rate=%u", req->move_mode, req->rate);
+  /* move mode 0 = stop, 1 = up, 3 = down */
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_HUE_SAT_MOVE,
+                                            .hue_sat_move = { WS2812A_SAT, (req->move_mode == 1) ? req->rate : ((req->move_mode == 3) ? -(int32_t)req->rate : 0) } });
+  APP_ZIGBEE_SetColorModeHS(cluster, false);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 7 ColorControl server 1 move_sat 1 */
 }
@@ -341,7 +349,10 @@ static enum ZclStatusCodeT colorControl_server_1_move_sat(struct ZbZclClusterT *
 static enum ZclStatusCodeT colorControl_server_1_step_sat(struct ZbZclClusterT *cluster, struct ZbZclColorClientStepSatReqT *req, struct ZbZclAddrInfoT *srcInfo, void *arg)
 {
   /* USER CODE BEGIN 8 ColorControl server 1 step_sat 1 */
-  APP_DBG("colorControl_server_1_step_sat");
+  APP_DBG("colorControl_server_1_step_sat, mode=%u, step=%u, trans=%u", req->step_mode, req->step_size, req->transition_time);
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_HUE_SAT_STEP,
+                                            .hue_sat_step = { WS2812A_SAT, (req->step_mode == 1) ? req->step_size : -(int32_t)req->step_size, req->transition_time * 100 } });
+  APP_ZIGBEE_SetColorModeHS(cluster, false);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 8 ColorControl server 1 step_sat 1 */
 }
@@ -350,7 +361,10 @@ static enum ZclStatusCodeT colorControl_server_1_step_sat(struct ZbZclClusterT *
 static enum ZclStatusCodeT colorControl_server_1_move_to_hue_sat(struct ZbZclClusterT *cluster, struct ZbZclColorClientMoveToHueSatReqT *req, struct ZbZclAddrInfoT *srcInfo, void *arg)
 {
   /* USER CODE BEGIN 9 ColorControl server 1 move_to_hue_sat 1 */
-  APP_DBG("colorControl_server_1_move_to_hue_sat");
+  APP_DBG("colorControl_server_1_move_to_hue_sat, hue=%u, sat=%u, trans=%u", req->hue, req->sat, req->transition_time);
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_HUE_SAT_MOVE_TO,
+                                            .hue_sat_move_to = { WS2812A_HUE | WS2812A_SAT, (uint16_t)req->hue << 8, req->sat, WS2812A_HUE_SHORTEST, req->transition_time * 100 } });
+  APP_ZIGBEE_SetColorModeHS(cluster, false);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 9 ColorControl server 1 move_to_hue_sat 1 */
 }
@@ -360,9 +374,9 @@ static enum ZclStatusCodeT colorControl_server_1_move_to_color_xy(struct ZbZclCl
 {
   /* USER CODE BEGIN 10 ColorControl server 1 move_to_color_xy 1 */
   APP_DBG("colorControl_server_1_move_to_color_xy, xy=(%u,%u), trans=%u", req->color_x, req->color_y, req->transition_time);
-  light_params.color_xy.X = req->color_x;
-  light_params.color_xy.Y = req->color_y;
-  light_params.set_color_XY = true;
+  /* transition time converted to milliseconds */
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_COLOR_XY,
+                                            .color_xy = { { req->color_x, req->color_y }, req->transition_time * 100 } });
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 10 ColorControl server 1 move_to_color_xy 1 */
 }
@@ -390,8 +404,9 @@ static enum ZclStatusCodeT colorControl_server_1_move_to_color_temp(struct ZbZcl
 {
   /* USER CODE BEGIN 13 ColorControl server 1 move_to_color_temp 1 */
   APP_DBG("colorControl_server_1_move_to_color_temp, temp=%u, trans=%u", req->color_temp, req->transition_time);
-  light_params.color_temp = req->color_temp;
-  light_params.set_color_temp = true;
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_TEMP_MOVE_TO,
+                                            .temp_move_to = { req->color_temp, req->transition_time * 100 } });
+  APP_ZIGBEE_SetColorModeTemp(cluster);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 13 ColorControl server 1 move_to_color_temp 1 */
 }
@@ -400,7 +415,10 @@ static enum ZclStatusCodeT colorControl_server_1_move_to_color_temp(struct ZbZcl
 static enum ZclStatusCodeT colorControl_server_1_move_to_hue_enh(struct ZbZclClusterT *cluster, struct ZbZclColorClientMoveToHueEnhReqT *req, struct ZbZclAddrInfoT *srcInfo, void *arg)
 {
   /* USER CODE BEGIN 14 ColorControl server 1 move_to_hue_enh 1 */
-  APP_DBG("colorControl_server_1_move_to_hue_enh");
+  APP_DBG("colorControl_server_1_move_to_hue_enh, hue=%u, dir=%u, trans=%u", req->enh_hue, req->direction, req->transition_time);
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_HUE_SAT_MOVE_TO,
+                                            .hue_sat_move_to = { WS2812A_HUE, req->enh_hue, 0, (WS2812A_HueDirTypeDef)req->direction, req->transition_time * 100 } });
+  APP_ZIGBEE_SetColorModeHS(cluster, true);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 14 ColorControl server 1 move_to_hue_enh 1 */
 }
@@ -409,7 +427,11 @@ static enum ZclStatusCodeT colorControl_server_1_move_to_hue_enh(struct ZbZclClu
 static enum ZclStatusCodeT colorControl_server_1_move_hue_enh(struct ZbZclClusterT *cluster, struct ZbZclColorClientMoveHueEnhReqT *req, struct ZbZclAddrInfoT *srcInfo, void *arg)
 {
   /* USER CODE BEGIN 15 ColorControl server 1 move_hue_enh 1 */
-  APP_DBG("colorControl_server_1_move_hue_enh");
+  APP_DBG("colorControl_server_1_move_hue_enh, mode=%u, rate=%u", req->move_mode, req->rate);
+  /* move mode 0 = stop, 1 = up, 3 = down */
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_HUE_SAT_MOVE,
+                                            .hue_sat_move = { WS2812A_HUE, (req->move_mode == 1) ? req->rate : ((req->move_mode == 3) ? -(int32_t)req->rate : 0) } });
+  APP_ZIGBEE_SetColorModeHS(cluster, true);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 15 ColorControl server 1 move_hue_enh 1 */
 }
@@ -418,7 +440,10 @@ static enum ZclStatusCodeT colorControl_server_1_move_hue_enh(struct ZbZclCluste
 static enum ZclStatusCodeT colorControl_server_1_step_hue_enh(struct ZbZclClusterT *cluster, struct ZbZclColorClientStepHueEnhReqT *req, struct ZbZclAddrInfoT *srcInfo, void *arg)
 {
   /* USER CODE BEGIN 16 ColorControl server 1 step_hue_enh 1 */
-  APP_DBG("colorControl_server_1_step_hue_enh");
+  APP_DBG("colorControl_server_1_step_hue_enh, mode=%u, step=%u, trans=%u", req->step_mode, req->step_size, req->transition_time);
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_HUE_SAT_STEP,
+                                            .hue_sat_step = { WS2812A_HUE, (req->step_mode == 1) ? req->step_size : -(int32_t)req->step_size, req->transition_time * 100 } });
+  APP_ZIGBEE_SetColorModeHS(cluster, true);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 16 ColorControl server 1 step_hue_enh 1 */
 }
@@ -427,7 +452,10 @@ static enum ZclStatusCodeT colorControl_server_1_step_hue_enh(struct ZbZclCluste
 static enum ZclStatusCodeT colorControl_server_1_move_to_hue_sat_enh(struct ZbZclClusterT *cluster, struct ZbZclColorClientMoveToHueSatEnhReqT *req, struct ZbZclAddrInfoT *srcInfo, void *arg)
 {
   /* USER CODE BEGIN 17 ColorControl server 1 move_to_hue_sat_enh 1 */
-  APP_DBG("colorControl_server_1_move_to_hue_sat_enh");
+  APP_DBG("colorControl_server_1_move_to_hue_sat_enh, hue=%u, sat=%u, trans=%u", req->enh_hue, req->sat, req->transition_time);
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_HUE_SAT_MOVE_TO,
+                                            .hue_sat_move_to = { WS2812A_HUE | WS2812A_SAT, req->enh_hue, req->sat, WS2812A_HUE_SHORTEST, req->transition_time * 100 } });
+  APP_ZIGBEE_SetColorModeHS(cluster, true);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 17 ColorControl server 1 move_to_hue_sat_enh 1 */
 }
@@ -437,46 +465,28 @@ static enum ZclStatusCodeT colorControl_server_1_color_loop_set(struct ZbZclClus
 {
   /* USER CODE BEGIN 18 ColorControl server 1 color_loop_set 1 */
   APP_DBG("colorControl_server_1_color_loop_set, act=%u, dir=%u, hue=%u, trans=%u, flags=%u", req->action, req->direction, req->start_hue, req->transition_time, req->update_flags);
+  WS2812A_Command_t command = { .type = WS2812A_CMD_LOOP_START, .loop_start = { 0, 0, req->direction } };
   if(req->action == 0)
   {
     /* loop off */
-    light_params.color_restore = true;
+    command.type = WS2812A_CMD_LOOP_STOP;
+  }
+  else if(req->action == 1)
+  {
+    /* select the previous effect for direction 0, otherwise the next effect */
+    command.loop_start.effect_step = (req->direction == 0) ? -1 : 1;
+  }
+  else if(req->start_hue > 0)
+  {
+    /* select the effect by index */
+    command.loop_start.effect = req->start_hue - 1;
   }
   else
   {
-    /* loop on */
-    light_params.loop_direction = req->direction;
-
-    if(req->action == 1)
-    {
-      /* increment/decrement loop mode */
-      if(light_params.loop_direction == 0)
-      {
-        /* decrement loop mode */
-        light_params.color_loop_mode = (light_params.color_loop_mode > 0) ? light_params.color_loop_mode - 1 : COLOR_LOOP_NUMB_MODES - 1;
-      }
-      else
-      {
-        /* increment loop mode */
-        light_params.color_loop_mode = (light_params.color_loop_mode < COLOR_LOOP_NUMB_MODES - 1) ? light_params.color_loop_mode + 1 : 0;
-      }
-    }
-    else
-    {
-      /* set loop mode */
-      if(req->start_hue > 0)
-      {
-        light_params.color_loop_mode = req->start_hue - 1;
-      }
-      else
-      {
-        /* hue == 0 means random mode */
-        light_params.color_loop_mode = rand() % COLOR_LOOP_NUMB_MODES;
-      }
-    }
-
-    light_params.color_mode = COLOR_LOOP;
+    /* hue == 0 means a random effect */
+    command.loop_start.effect = PRNG_Random(WS2812A_GetNumbEffects());
   }
+  WS2812A_PostCommand(&command);
  
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 18 ColorControl server 1 color_loop_set 1 */
@@ -487,6 +497,7 @@ static enum ZclStatusCodeT colorControl_server_1_stop_move_step(struct ZbZclClus
 {
   /* USER CODE BEGIN 19 ColorControl server 1 stop_move_step 1 */
   APP_DBG("colorControl_server_1_stop_move_step");
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_COLOR_STOP });
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 19 ColorControl server 1 stop_move_step 1 */
 }
@@ -495,7 +506,11 @@ static enum ZclStatusCodeT colorControl_server_1_stop_move_step(struct ZbZclClus
 static enum ZclStatusCodeT colorControl_server_1_move_color_temp(struct ZbZclClusterT *cluster, struct ZbZclColorClientMoveColorTempReqT *req, struct ZbZclAddrInfoT *srcInfo, void *arg)
 {
   /* USER CODE BEGIN 20 ColorControl server 1 move_color_temp 1 */
-  APP_DBG("colorControl_server_1_move_color_temp");
+  APP_DBG("colorControl_server_1_move_color_temp, mode=%u, rate=%u, min=%u, max=%u", req->move_mode, req->rate, req->color_temp_min, req->color_temp_max);
+  /* move mode 0 = stop, 1 = up, 3 = down */
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_TEMP_MOVE,
+                                            .temp_move = { (req->move_mode == 1) ? req->rate : ((req->move_mode == 3) ? -(int32_t)req->rate : 0), req->color_temp_min, req->color_temp_max } });
+  APP_ZIGBEE_SetColorModeTemp(cluster);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 20 ColorControl server 1 move_color_temp 1 */
 }
@@ -504,7 +519,10 @@ static enum ZclStatusCodeT colorControl_server_1_move_color_temp(struct ZbZclClu
 static enum ZclStatusCodeT colorControl_server_1_step_color_temp(struct ZbZclClusterT *cluster, struct ZbZclColorClientStepColorTempReqT *req, struct ZbZclAddrInfoT *srcInfo, void *arg)
 {
   /* USER CODE BEGIN 21 ColorControl server 1 step_color_temp 1 */
-  APP_DBG("colorControl_server_1_step_color_temp");
+  APP_DBG("colorControl_server_1_step_color_temp, mode=%u, step=%u, trans=%u, min=%u, max=%u", req->step_mode, req->step_size, req->transition_time, req->color_temp_min, req->color_temp_max);
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_TEMP_STEP,
+                                            .temp_step = { (req->step_mode == 1) ? req->step_size : -(int32_t)req->step_size, req->transition_time * 100, req->color_temp_min, req->color_temp_max } });
+  APP_ZIGBEE_SetColorModeTemp(cluster);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 21 ColorControl server 1 step_color_temp 1 */
 }
@@ -514,12 +532,9 @@ static enum ZclStatusCodeT levelControl_server_1_move_to_level(struct ZbZclClust
 {
   /* USER CODE BEGIN 22 LevelControl server 1 move_to_level 1 */
   APP_DBG("levelControl_server_1_move_to_level, level=%u, trans=%u, with_onoff=%u", req->level, req->transition_time, req->with_onoff);
-  light_params.level_on = req->level;
-  if(req->with_onoff)
-  {
-    light_params.level_target = light_params.level_on;
-    light_params.transition_time = req->transition_time * 100;  /* conversion to milliseconds */
-  }
+  /* transition time converted to milliseconds */
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_LEVEL_MOVE_TO,
+                                            .level_move_to = { req->level, req->with_onoff, req->transition_time * 100 } });
   (void)ZbZclAttrIntegerWrite(cluster, ZCL_LEVEL_ATTR_CURRLEVEL, req->level);
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 22 LevelControl server 1 move_to_level 1 */
@@ -530,7 +545,7 @@ static enum ZclStatusCodeT levelControl_server_1_move(struct ZbZclClusterT *clus
 {
   /* USER CODE BEGIN 23 LevelControl server 1 move 1 */
   APP_DBG("levelControl_server_1_move, mode=%u, rate=%u, with_onoff=%u", req->mode, req->rate, req->with_onoff);
-  brightness_move(req->mode, req->rate);  
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_LEVEL_MOVE, .level_move = { req->mode, req->rate } });
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 23 LevelControl server 1 move 1 */
 }
@@ -540,37 +555,9 @@ static enum ZclStatusCodeT levelControl_server_1_step(struct ZbZclClusterT *clus
 {
   /* USER CODE BEGIN 24 LevelControl server 1 step 1 */
   APP_DBG("levelControl_server_1_step, step=%u, dir=%u, trans=%u, with_onoff=%u", req->size, req->mode, req->transition_time, req->with_onoff);
-
-  if(light_params.level_target != 0)
-  {
-    //currently the brightness is handled only if the light is ON
-    if(req->mode == 0)
-    {
-      //brightness up
-      if(0xFF - light_params.level_target > req->size)
-      {
-        light_params.level_target += req->size;
-      }
-      else
-      {
-        light_params.level_target = 0xFE;
-      }
-    }
-    else
-    {
-      //brightness down
-      if(light_params.level_target > req->size)
-      {
-        light_params.level_target -= req->size;
-      }
-      else
-      {
-        light_params.level_target = 0x01;
-      }
-    }
-    light_params.level_on = light_params.level_target;
-    light_params.transition_time = req->transition_time * 100;  /* conversion to milliseconds */
-    } 
+  //currently the brightness is handled only if the light is ON; transition time converted to milliseconds
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_LEVEL_STEP,
+                                            .level_step = { req->mode, req->size, req->transition_time * 100 } });
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 24 LevelControl server 1 step 1 */
 }
@@ -580,7 +567,8 @@ static enum ZclStatusCodeT levelControl_server_1_stop(struct ZbZclClusterT *clus
 {
   /* USER CODE BEGIN 25 LevelControl server 1 stop 1 */
   APP_DBG("levelControl_server_1_stop");
-  brightness_move(0, 0); //stop any ongoing brightness transition
+  //stop any ongoing brightness transition
+  WS2812A_PostCommand(&(WS2812A_Command_t){ .type = WS2812A_CMD_LEVEL_MOVE, .level_move = { 0, 0 } });
   return ZCL_STATUS_SUCCESS;
   /* USER CODE END 25 LevelControl server 1 stop 1 */
 }
@@ -736,6 +724,18 @@ static void APP_ZIGBEE_ConfigEndpoints(void)
       ZCL_COLOR_ATTR_REMAINING_TIME, ZCL_DATATYPE_UNSIGNED_16BIT,
       ZCL_ATTR_FLAG_REPORTABLE, 0, NULL, {0, 0}, {0, 0}
     },
+    {
+      ZCL_COLOR_ATTR_CURRENT_HUE, ZCL_DATATYPE_UNSIGNED_8BIT,
+      ZCL_ATTR_FLAG_REPORTABLE | ZCL_ATTR_FLAG_PERSISTABLE, 0, NULL, {0, 0}, {0, 0}
+    },
+    {
+      ZCL_COLOR_ATTR_CURRENT_SAT, ZCL_DATATYPE_UNSIGNED_8BIT,
+      ZCL_ATTR_FLAG_REPORTABLE | ZCL_ATTR_FLAG_PERSISTABLE, 0, NULL, {0, 0}, {0, 0}
+    },
+    {
+      ZCL_COLOR_ATTR_ENH_CURR_HUE, ZCL_DATATYPE_UNSIGNED_16BIT,
+      ZCL_ATTR_FLAG_REPORTABLE | ZCL_ATTR_FLAG_PERSISTABLE, 0, NULL, {0, 0}, {0, 0}
+    },
     {
       ZCL_COLOR_ATTR_CURRENT_X, ZCL_DATATYPE_UNSIGNED_16BIT,
       ZCL_ATTR_FLAG_REPORTABLE | ZCL_ATTR_FLAG_PERSISTABLE, 0, NULL, {0, 0}, {0, 0}
@@ -1255,4 +1255,38 @@ static void APP_ZIGBEE_JoinReq(struct ZigBeeT* zb, void* arg)
 
 	(void)ZbTimerReset(joinReqTimer, 60 * 1000);
 }
+
+/* sets the color mode attributes after a hue or saturation command */
+static void APP_ZIGBEE_SetColorModeHS(struct ZbZclClusterT *cluster, bool enhanced)
+{
+  (void)ZbZclAttrIntegerWrite(cluster, ZCL_COLOR_ATTR_COLOR_MODE, ZCL_COLOR_MODE_HS);
+  (void)ZbZclAttrIntegerWrite(cluster, ZCL_COLOR_ATTR_ENH_COLOR_MODE, enhanced ? ZCL_COLOR_ENH_MODE_ENH_HUE_SAT : ZCL_COLOR_ENH_MODE_CURR_HS);
+}
+
+/* sets the color mode attributes after a color temperature command */
+static void APP_ZIGBEE_SetColorModeTemp(struct ZbZclClusterT *cluster)
+{
+  (void)ZbZclAttrIntegerWrite(cluster, ZCL_COLOR_ATTR_COLOR_MODE, ZCL_COLOR_MODE_TEMP);
+  (void)ZbZclAttrIntegerWrite(cluster, ZCL_COLOR_ATTR_ENH_COLOR_MODE, ZCL_COLOR_ENH_MODE_COLOR_TEMP);
+}
+
+/* the color temperature reached by the light engine is reported in the color temperature attribute */
+void WS2812A_ColorTempCallback(uint16_t color_temp)
+{
+  (void)ZbZclAttrIntegerWrite(zigbee_app_info.colorControl_server_1, ZCL_COLOR_ATTR_COLOR_TEMP_MIREDS, color_temp);
+}
+
+/* the hue and saturation reached by the light engine are reported in the color attributes */
+void WS2812A_HueSatCallback(uint16_t enh_hue, uint8_t sat)
+{
+  (void)ZbZclAttrIntegerWrite(zigbee_app_info.colorControl_server_1, ZCL_COLOR_ATTR_ENH_CURR_HUE, enh_hue);
+  (void)ZbZclAttrIntegerWrite(zigbee_app_info.colorControl_server_1, ZCL_COLOR_ATTR_CURRENT_HUE, enh_hue >> 8);
+  (void)ZbZclAttrIntegerWrite(zigbee_app_info.colorControl_server_1, ZCL_COLOR_ATTR_CURRENT_SAT, sat);
+}
+
+/* the color transition progress of the light engine is reported in the remaining time attribute */
+void WS2812A_RemainingTimeCallback(uint16_t remaining_time)
+{
+  (void)ZbZclAttrIntegerWrite(zigbee_app_info.colorControl_server_1, ZCL_COLOR_ATTR_REMAINING_TIME, remaining_time);
+}
 /* USER CODE END FD_LOCAL_FUNCTIONS */